@@ -0,0 +1,250 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Benchmark of locality-aware placement of Staff (see `StaffCore::colocate`): groups of
+ logical processes share a Fluid each; every step of a process updates part of its group`s
+ Fluid and of own private state (and blocks on the Fluid when denied). The same workload
+ executed with locality disabled and enabled (alternately, `repeat` times); throughput
+ (DONE steps per second), moves of processes between members and hardware cache misses
+ of the whole program (perf_event_open, inherited by the Staff threads) reported.
+
+ Usage: affinity.bench [ key=value ... ]
+
+   threads=4          working threads
+   groups=8           number of Fluids (groups of processes)
+   size=4             processes per group
+   payload=65536      size of the Fluid, bytes
+   state=16384        size of the private state of a process, bytes
+   lines=64           cache lines of the Fluid and of the private state touched by a step
+   duration=500       measured interval, millisec
+   warmup=100         interval before measurement, millisec
+   repeat=3           repetitions of every mode
+   format=text        `text` (log) or `csv`
+   output=FILE        file for `csv` (default: affinity.bench.csv)
+
+ Cache misses reported as `n/a` if hardware counters not available (virtual machine,
+ perf_event_paranoid and so on).
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "logger.global.h"
+#include "logical.process.h"
+#include "fluid.h"
+#include "staff.h"
+#include "timer.h"
+
+namespace CoreAGI {
+
+  struct Options {
+    unsigned threads { 4       };
+    unsigned groups  { 8       };
+    unsigned size    { 4       };
+    size_t   payload { 65536   };
+    size_t   state   { 16384   };
+    unsigned lines   { 64      };
+    unsigned duration{ 500     };
+    unsigned warmup  { 100     };
+    unsigned repeat  { 3       };
+  };
+
+  class Counter {
+                                                                                                                              /*
+    Hardware event counted for this thread and threads created after opening (inherit):
+                                                                                                                              */
+    int fd;
+
+  public:
+
+    Counter( uint32_t type, uint64_t config ): fd{ -1 } {
+      perf_event_attr A;
+      std::memset( &A, 0, sizeof( A ) );
+      A.size           = sizeof( A );
+      A.type           = type;
+      A.config         = config;
+      A.disabled       = 1;
+      A.inherit        = 1;
+      A.exclude_kernel = 1;
+      A.exclude_hv     = 1;
+      fd = int( syscall( __NR_perf_event_open, &A, 0, -1, -1, 0 ) );
+    }
+
+    Counter( const Counter& )              = delete;
+    Counter& operator = ( const Counter& ) = delete;
+
+    bool valid() const { return fd >= 0; }
+
+    void start(){ if( fd >= 0 ){ ioctl( fd, PERF_EVENT_IOC_RESET, 0 ); ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 ); } }
+    void stop (){ if( fd >= 0 ) ioctl( fd, PERF_EVENT_IOC_DISABLE, 0 ); }
+
+    double value() const {
+      uint64_t v{ 0 };
+      if( fd < 0 or ::read( fd, &v, sizeof( v ) ) != sizeof( v ) ) return -1;
+      return double( v );
+    }
+
+   ~Counter(){ if( fd >= 0 ) close( fd ); }
+
+  };//Counter
+
+  class BenchStaff: public StaffCore {
+  public:
+    BenchStaff( const LogicalProcess** PROCESS, unsigned n ): StaffCore( PROCESS, n, n, n, Dispatch::STEALING ){}
+  };
+
+  struct Cells {
+    std::unique_ptr< uint64_t[] > word;
+    Cells(): word{} {}
+  };
+
+  struct Sample {
+    double rate;       // :DONE steps per second
+    double migrations; // :co-location moves per second
+    double steals;     // :rebalancing moves per second
+    double misses;     // :cache misses per step, -1 if not available
+    double l1;         // :L1 data cache read misses per step, -1 if not available
+  };
+
+  Sample measure( const Options& O, bool locality ){
+    const unsigned N    { O.groups*O.size              };
+    const size_t   WORDS{ O.payload/sizeof( uint64_t ) };
+    const size_t   OWN  { O.state  /sizeof( uint64_t ) };
+    auto fluid = std::make_unique< Fluid< Cells >[] >( O.groups );
+    for( unsigned g = 0; g < O.groups; g++ ) fluid[g].alter( [&]( Cells& C ){ C.word = std::make_unique< uint64_t[] >( WORDS ); } );
+    std::vector< std::unique_ptr< uint64_t[] > >       own;
+    std::vector< std::unique_ptr< LogicalProcess > >   L;
+    std::vector< const LogicalProcess* >               P;
+    for( unsigned i = 0; i < N; i++ ){
+      own.emplace_back( std::make_unique< uint64_t[] >( OWN ) );
+      Fluid< Cells >& F = fluid[ i / O.size ]; // :members of a group spread over Staff members at start
+      uint64_t*       S = own.back().get();
+      L.emplace_back( std::make_unique< LogicalProcess >( "worker", [ &F, S, &O, WORDS, OWN ]( const Log& )->bool {
+        uint64_t sum{ 0 };
+        for( unsigned k = 0; k < O.lines; k++ ) sum += ++S[ ( 8*k ) % OWN ];
+        const bool done = F.alter( [&]( Cells& C ){ for( unsigned k = 0; k < O.lines; k++ ) C.word[ ( 8*k ) % WORDS ] += sum; } );
+        return done ? true : LogicalProcess::block( F, FluidCore::Access::WRITE );
+      }));
+      P.push_back( L.back().get() );
+    }
+    P.push_back( nullptr );
+
+    using R = LogicalProcess::Statistics;
+    auto done = [&]{ double n{ 0 }; for( auto& p: L ) n += double( p->statistics()[ R::DONE ] ); return n; };
+
+    Counter misses( PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES );
+    Counter l1    ( PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) );
+    Sample S{};
+    {
+      BenchStaff staff( P.data(), O.threads );
+      staff.locality( locality );
+      for( auto& p: L ) p->start();
+      staff.start();
+      CoreAGI::pause{ O.warmup }[ MILLISEC ];
+      const double   done0{ done() };
+      const uint64_t m0{ staff.migrations() }, s0{ staff.steals() };
+      misses.start(); l1.start();
+      Timer timer;
+      CoreAGI::pause{ O.duration }[ MILLISEC ];
+      const double   done1{ done() };
+      const uint64_t m1{ staff.migrations() }, s1{ staff.steals() };
+      const double   span { timer.stop().sec()           };
+      misses.stop(); l1.stop();
+      for( auto& p: L ) p->stop();
+      staff.stop();
+      const double steps{ std::max( 1.0, done1 - done0 ) };
+      S.rate       = ( done1 - done0 )/span;
+      S.migrations = double( m1 - m0 )/span;
+      S.steals     = double( s1 - s0 )/span;
+      S.misses     = misses.valid() ? misses.value()/steps : -1;
+      S.l1         = l1    .valid() ? l1    .value()/steps : -1;
+    }
+    return S;
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  Options     O;
+  std::string FORMAT{ "text" }, OUTPUT{ "affinity.bench.csv" };
+  for( int i = 1; i < argc; i++ ){
+    const char* eq = strchr( argv[i], '=' );
+    const std::string key( argv[i], eq ? eq - argv[i] : strlen( argv[i] ) );
+    const char* value{ eq ? eq + 1 : "" };
+    if     ( key == "threads"  ) O.threads  = std::max( 1, atoi( value ) );
+    else if( key == "groups"   ) O.groups   = std::max( 1, atoi( value ) );
+    else if( key == "size"     ) O.size     = std::max( 1, atoi( value ) );
+    else if( key == "payload"  ) O.payload  = std::max( size_t( 64 ), size_t( atoll( value ) ) );
+    else if( key == "state"    ) O.state    = std::max( size_t( 64 ), size_t( atoll( value ) ) );
+    else if( key == "lines"    ) O.lines    = std::max( 1, atoi( value ) );
+    else if( key == "duration" ) O.duration = unsigned( atoi( value ) );
+    else if( key == "warmup"   ) O.warmup   = unsigned( atoi( value ) );
+    else if( key == "repeat"   ) O.repeat   = std::max( 1, atoi( value ) );
+    else if( key == "format"   ) FORMAT     = value;
+    else if( key == "output"   ) OUTPUT     = value;
+    else {
+      fprintf( stderr, "Usage: affinity.bench [ threads= groups= size= payload= state= lines= duration= warmup= repeat= format=text|csv output= ]\n" );
+      return 1;
+    }
+  }
+
+  auto log = logger.log( "affinity" );
+  FILE* out{ nullptr };
+  if( FORMAT == "csv" ){
+    out = fopen( OUTPUT.c_str(), "w" );
+    if( not out ){ log.vital( kit( "can`t open %s", OUTPUT.c_str() ) ); return 1; }
+    fprintf( out, "locality,repetition,threads,groups,size,payload,state,lines,steps_per_sec,migrations_per_sec,steals_per_sec,"
+                  "cache_misses_per_step,l1d_misses_per_step\n" );
+  }
+  log.vital( kit( "%u threads, %u groups of %u processes, Fluid %zu bytes, state %zu bytes, %u lines per step, %u millisec",
+                  O.threads, O.groups, O.size, O.payload, O.state, O.lines, O.duration ) );
+
+  Sample total[2]{};
+  for( unsigned r = 0; r < O.repeat; r++ ){
+    for( unsigned mode = 0; mode < 2; mode++ ){
+      const Sample S{ measure( O, mode == 1 ) };
+      total[ mode ].rate += S.rate/O.repeat;
+      total[ mode ].misses = S.misses < 0 ? -1 : total[ mode ].misses + S.misses/O.repeat;
+      total[ mode ].l1     = S.l1     < 0 ? -1 : total[ mode ].l1     + S.l1    /O.repeat;
+      auto number = []( double v ){ return v < 0 ? std::string( "n/a" ) : kit( "%.2f", v ); };
+      log.vital( kit( "  locality %-3s  %12.0f steps/sec  %9.0f migrations/sec  %9.0f steals/sec  misses/step %8s  L1D/step %8s",
+                      mode ? "on" : "off", S.rate, S.migrations, S.steals, number( S.misses ).c_str(), number( S.l1 ).c_str() ) );
+      if( out ){
+        fprintf( out, "%u,%u,%u,%u,%u,%zu,%zu,%u,%.0f,%.0f,%.0f,%.3f,%.3f\n", mode, r, O.threads, O.groups, O.size, O.payload, O.state,
+                 O.lines, S.rate, S.migrations, S.steals, S.misses, S.l1 );
+        fflush( out );
+      }
+    }
+  }
+  log.vital( kit( "Throughput gain of locality: %+.1f %%", 100.0*( total[1].rate/std::max( 1.0, total[0].rate ) - 1.0 ) ) );
+  if( total[0].misses > 0 and total[1].misses >= 0 ){
+    log.vital( kit( "Cache misses per step: %.2f -> %.2f", total[0].misses, total[1].misses ) );
+  }
+  if( out ) fclose( out );
+  log.flush();
+
+  CoreAGI::pause{ 100 }[ MILLISEC ];
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Scratch memory of steps: every Staff member owns bump-pointer `Arena` reset after each
+ occupation of a process (step or quantum of steps, see `LogicalProcess::Quantum`), so
+ temporary vectors and strings built by a step don`t touch the global allocator:
+
+   LogicalProcess scan( "scan", [&]( const Log& log )->bool {
+     std::pmr::vector< unsigned > hits( scratch() );
+     ...
+     log.brief( scratchKit( "%zu hits", hits.size() ).c_str() );
+     return true;
+   });
+
+ `scratch()` is `std::pmr::memory_resource` of the arena of the current thread (global heap
+ outside of Staff members). Deallocation does nothing, memory returned by the reset:
+ scratch data must not outlive the step (not stored into process state, Fluid and so on).
+
+ Arena grows by chunks of ARENA_BLOCK KiB (larger for large requests); reset keeps up to
+ ARENA_RETAIN KiB of chunks for the next steps and frees the rest.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+#include "config.h"
+
+namespace CoreAGI {
+
+  class Arena {
+
+    struct Chunk {
+      Chunk* next;
+      size_t size; // :bytes available after the header
+      char*  data(){ return reinterpret_cast< char* >( this + 1 ); }
+    };
+
+    static_assert( sizeof( Chunk ) % alignof( std::max_align_t ) == 0 );
+
+    const size_t BLOCK;
+    const size_t RETAIN;
+    Chunk*       used;    // :chunks allocated from since reset, current one first
+    Chunk*       spare;   // :free chunks kept by reset
+    char*        cursor;
+    char*        limit;
+    size_t       held;    // :bytes of all chunks
+    uint64_t     cleared; // :number of resets that returned something
+
+    static Chunk* create( size_t size ){
+      void* memory{ std::malloc( sizeof( Chunk ) + size ) };
+      if( not memory ) throw std::bad_alloc();
+      return new( memory ) Chunk{ nullptr, size };
+    }
+
+    void* refill( size_t size, size_t align ){
+                                                                                                                              /*
+      Current chunk exhausted: first spare chunk that fits or a new one:
+                                                                                                                              */
+      const size_t need{ size + align };
+      Chunk** link{ &spare };
+      while( *link and ( *link )->size < need ) link = &( *link )->next;
+      Chunk* c{ *link };
+      if( c ) *link = c->next;
+      else  { c = create( std::max( BLOCK, need ) ); held += c->size; }
+      c->next = used;
+      used    = c;
+      cursor  = c->data();
+      limit   = cursor + c->size;
+      return allocate( size, align );
+    }
+
+  public:
+
+    explicit Arena( size_t block = 1024*size_t( Config::staff::ARENA_BLOCK ), size_t retain = 1024*size_t( Config::staff::ARENA_RETAIN ) ):
+      BLOCK  { block   },
+      RETAIN { retain  },
+      used   { nullptr },
+      spare  { nullptr },
+      cursor { nullptr },
+      limit  { nullptr },
+      held   { 0       },
+      cleared{ 0       }
+    {}
+
+    Arena( const Arena& )              = delete;
+    Arena& operator = ( const Arena& ) = delete;
+
+    void* allocate( size_t size, size_t align = alignof( std::max_align_t ) ){
+      assert( align > 0 and ( align & ( align - 1 ) ) == 0 );
+      const uintptr_t p{ ( reinterpret_cast< uintptr_t >( cursor ) + align - 1 ) & ~uintptr_t( align - 1 ) };
+      if( cursor and p + size <= reinterpret_cast< uintptr_t >( limit ) ){
+        cursor = reinterpret_cast< char* >( p + size );
+        return reinterpret_cast< void* >( p );
+      }
+      return refill( size, align );
+    }
+
+    void reset(){
+                                                                                                                              /*
+      All memory allocated since the last reset returned at once; chunks kept up to RETAIN:
+                                                                                                                              */
+      if( not used ) return;
+      while( used ){
+        Chunk* c{ used };
+        used = c->next;
+        if( held > RETAIN ){ held -= c->size; std::free( c ); continue; }
+        c->next = spare;
+        spare   = c;
+      }
+      cursor = limit = nullptr;
+      cleared++;
+    }
+
+    size_t   capacity() const { return held;    } // :bytes of chunks held
+    uint64_t resets  () const { return cleared; }
+
+   ~Arena(){
+      reset();
+      while( spare ){ Chunk* c{ spare }; spare = c->next; std::free( c ); }
+    }
+
+  };//Arena
+
+                                                                                                                              /*
+  Adapter of the arena for standard containers (`std::pmr::vector`, `std::pmr::string` and so on):
+                                                                                                                              */
+  class ArenaResource: public std::pmr::memory_resource {
+
+    Arena& arena;
+
+    inline static thread_local ArenaResource* active{ nullptr }; // :scratch of the current thread
+
+    void* do_allocate  ( size_t size, size_t align ) override { return arena.allocate( size, align ); }
+    void  do_deallocate( void*, size_t, size_t     ) override {}
+    bool  do_is_equal  ( const std::pmr::memory_resource& other ) const noexcept override { return this == &other; }
+
+  public:
+
+    explicit ArenaResource( Arena& A ): arena{ A }{}
+
+    Arena& source(){ return arena; }
+
+    static void           enter  ( ArenaResource* R ){ active = R;    } // :called by Staff member thread
+    static ArenaResource* current(                   ){ return active; }
+
+  };//ArenaResource
+
+
+  inline std::pmr::memory_resource* scratch(){
+                                                                                                                              /*
+    Scratch memory of the current step; global heap if the thread has no arena:
+                                                                                                                              */
+    ArenaResource* R{ ArenaResource::current() };
+    return R ? static_cast< std::pmr::memory_resource* >( R ) : std::pmr::new_delete_resource();
+  }
+
+  template< typename... Parameter > std::pmr::string scratchKit( const char* format, Parameter... parameters ){
+                                                                                                                              /*
+    Formatted string in scratch memory (see `kit` of `def.h`):
+                                                                                                                              */
+    constexpr unsigned CAPACITY{ 2046 };
+    char text[ CAPACITY + 2 ];
+    snprintf( text, CAPACITY, format, parameters... );
+    return std::pmr::string( text, scratch() );
+  }
+
+}//namespace CoreAGI
+
+#endif // ARENA_H_INCLUDED
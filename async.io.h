@@ -0,0 +1,364 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Asynchronous file I/O for logical processes: step submits read, write or fsync with a
+ completion handle (`Offload< int64_t >`, see `offload.h`) and finishes waiting; process
+ resumed by Staff when the operation completed and takes the result (number of bytes
+ or negative `errno`) at the next step:
+
+   AsyncIO            io;
+   Offload< int64_t > done;
+   LogicalProcess loader( "loader", [&]( const Log& log )->bool {
+     if( done.idle() ) return io.read( done, fd, buffer, SIZE, offset );
+     if( not done.ready() ) return LogicalProcess::block( done );
+     const int64_t n{ done.take() };
+     ...
+     return true;
+   });
+
+ Backend is io_uring (raw system calls, no liburing) if the kernel allows it: submitters
+ only put entries into the submission ring; completion thread submits all accumulated
+ entries by single `io_uring_enter` (batching), waits for completions and resumes the
+ processes. While requests are in flight new entries wait at most FLUSH_PERIOD; when
+ nothing in flight completion thread sleeps and the first submission wakes it up.
+ Buffers registered by `enroll` are used without per-request page pinning for the
+ transfers that name them (`fixed` index).
+
+ Without io_uring (old kernel, seccomp, `io_uring_disabled`) operations executed by the
+ pool of blocking threads by `pread`/`pwrite`/`fsync` (see `OffloadPool`); `enroll` and
+ `fixed` index then accepted and ignored.
+
+ Handles and buffers must outlive the operations. Operation requested after `stop`
+ completes the handle at once with `-ECANCELED` (the step is not blocked).
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef ASYNC_IO_H_INCLUDED
+#define ASYNC_IO_H_INCLUDED
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "logger.h"
+#include "logical.process.h"
+#include "offload.h"
+
+namespace CoreAGI {
+
+  class AsyncIO {
+  public:
+
+    using Handle = Offload< int64_t >;
+
+  private:
+
+    struct Ring {
+                                                                                                                              /*
+      Mapped io_uring: submission ring (indices into `sqe`) and completion ring:
+                                                                                                                              */
+      int            fd      { -1      };
+      unsigned       entries { 0       };
+      void*          sqMap   { nullptr };
+      size_t         sqSize  { 0       };
+      void*          cqMap   { nullptr };
+      size_t         cqSize  { 0       };
+      io_uring_sqe*  sqe     { nullptr };
+      unsigned*      sqHead  { nullptr };
+      unsigned*      sqTail  { nullptr };
+      unsigned*      sqMask  { nullptr };
+      unsigned*      sqArray { nullptr };
+      unsigned*      cqHead  { nullptr };
+      unsigned*      cqTail  { nullptr };
+      unsigned*      cqMask  { nullptr };
+      io_uring_cqe*  cqe     { nullptr };
+
+      static unsigned load ( unsigned* p ){ return std::atomic_ref< unsigned >( *p ).load( std::memory_order_acquire ); }
+      static void     store( unsigned* p, unsigned v ){ std::atomic_ref< unsigned >( *p ).store( v, std::memory_order_release ); }
+
+      bool open( unsigned size ){
+        io_uring_params P;
+        std::memset( &P, 0, sizeof( P ) );
+        fd = int( syscall( __NR_io_uring_setup, size, &P ) );
+        if( fd < 0 ) return false;
+        if( not ( P.features & IORING_FEAT_EXT_ARG ) ){ close(); return false; } // :timed wait needed
+        entries = P.sq_entries;
+        sqSize  = P.sq_off.array + P.sq_entries*sizeof( unsigned );
+        cqSize  = P.cq_off.cqes  + P.cq_entries*sizeof( io_uring_cqe );
+        const bool single{ ( P.features & IORING_FEAT_SINGLE_MMAP ) != 0 };
+        if( single ) sqSize = cqSize = std::max( sqSize, cqSize );
+        sqMap = mmap( nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING );
+        if( sqMap == MAP_FAILED ){ sqMap = nullptr; close(); return false; }
+        cqMap = single ? sqMap : mmap( nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING );
+        if( cqMap == MAP_FAILED ){ cqMap = nullptr; close(); return false; }
+        void* S = mmap( nullptr, P.sq_entries*sizeof( io_uring_sqe ), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES );
+        if( S == MAP_FAILED ){ close(); return false; }
+        sqe = static_cast< io_uring_sqe* >( S );
+        char* sq = static_cast< char* >( sqMap );
+        char* cq = static_cast< char* >( cqMap );
+        sqHead  = reinterpret_cast< unsigned*     >( sq + P.sq_off.head         );
+        sqTail  = reinterpret_cast< unsigned*     >( sq + P.sq_off.tail         );
+        sqMask  = reinterpret_cast< unsigned*     >( sq + P.sq_off.ring_mask    );
+        sqArray = reinterpret_cast< unsigned*     >( sq + P.sq_off.array        );
+        cqHead  = reinterpret_cast< unsigned*     >( cq + P.cq_off.head         );
+        cqTail  = reinterpret_cast< unsigned*     >( cq + P.cq_off.tail         );
+        cqMask  = reinterpret_cast< unsigned*     >( cq + P.cq_off.ring_mask    );
+        cqe     = reinterpret_cast< io_uring_cqe* >( cq + P.cq_off.cqes         );
+        return true;
+      }
+
+      void close(){
+        if( sqe ) munmap( sqe, entries*sizeof( io_uring_sqe ) );
+        if( cqMap and cqMap != sqMap ) munmap( cqMap, cqSize );
+        if( sqMap ) munmap( sqMap, sqSize );
+        if( fd >= 0 ) ::close( fd );
+        fd = -1; sqe = nullptr; sqMap = cqMap = nullptr;
+      }
+
+      int enter( unsigned submit, unsigned wait, unsigned timeout ){
+                                                                                                                              /*
+        Submit `submit` entries and wait up to `timeout` microsec for `wait` completions:
+                                                                                                                              */
+        __kernel_timespec T{ 0, 1000ll*timeout };
+        io_uring_getevents_arg A;
+        std::memset( &A, 0, sizeof( A ) );
+        A.ts = uint64_t( reinterpret_cast< uintptr_t >( &T ) );
+        const unsigned flags{ wait ? unsigned( IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG ) : 0u };
+        const int r = int( syscall( __NR_io_uring_enter, fd, submit, wait, flags, wait ? &A : nullptr, sizeof( A ) ) );
+        return r < 0 ? -errno : r;
+      }
+    };
+
+    Ring                            ring;
+    bool                            URING;       // :io_uring backend used (fixed at construction)
+    std::unique_ptr< OffloadPool >  pool;        // :fallback backend
+    std::mutex                      guard;       // :protects submission side of the ring, `overflow`, `unsubmitted`, `sleeping`
+    std::condition_variable         bell;
+    std::deque< io_uring_sqe >      overflow;    // :entries waiting for space in the submission ring
+    unsigned                        unsubmitted; // :entries put into the ring but not passed to the kernel
+    unsigned                        inflight;    // :passed to the kernel, not completed; completion thread only
+    bool                            sleeping;    // :completion thread waits for submissions
+    bool                            terminate;   // :stopped, new operations cancelled
+    std::atomic< uint64_t >         submitted;
+    std::atomic< uint64_t >         completed;
+    std::atomic< uint64_t >         batches;     // :`io_uring_enter` calls that submitted something
+    std::thread                     reaper;
+
+    bool push( const io_uring_sqe& E ){
+                                                                                                                              /*
+      Put entry into submission ring (under `guard`); `false` if the ring is full:
+                                                                                                                              */
+      const unsigned tail{ *ring.sqTail };
+      if( tail - Ring::load( ring.sqHead ) >= ring.entries ) return false;
+      const unsigned i{ tail & *ring.sqMask };
+      ring.sqe[i]     = E;
+      ring.sqArray[i] = i;
+      Ring::store( ring.sqTail, tail + 1 );
+      unsubmitted++;
+      return true;
+    }
+
+    bool cancel( Handle& handle ){
+                                                                                                                              /*
+      Operation requested (and counted as submitted) after `stop`: completed at once, the
+      step is not blocked:
+                                                                                                                              */
+      completed.fetch_add( 1, std::memory_order_relaxed );
+      handle.complete( -int64_t( ECANCELED ) );
+      return false;
+    }
+
+    bool enqueue( Handle& handle, const io_uring_sqe& E ){
+      [[maybe_unused]] const unsigned before{ handle.phase.exchange( Handle::PENDING ) };
+      assert( before == Handle::IDLE );
+      bool wake{ false };
+      {
+        std::lock_guard< std::mutex > lock( guard );
+        submitted.fetch_add( 1, std::memory_order_relaxed );
+        if( terminate ) return cancel( handle ); // :completion thread finished or finishes soon
+        if( not overflow.empty() or not push( E ) ) overflow.push_back( E );
+        wake = sleeping;
+      }
+      if( wake ) bell.notify_one();
+      return LogicalProcess::block( handle );
+    }
+
+    static io_uring_sqe entry( unsigned char op, int fd, const void* buffer, size_t size, uint64_t offset, int fixed, Handle& handle ){
+      io_uring_sqe E;
+      std::memset( &E, 0, sizeof( E ) );
+      E.opcode    = op;
+      E.fd        = fd;
+      E.addr      = uint64_t( reinterpret_cast< uintptr_t >( buffer ) );
+      E.len       = unsigned( size );
+      E.off       = offset;
+      E.user_data = uint64_t( reinterpret_cast< uintptr_t >( &handle ) );
+      if( fixed >= 0 ) E.buf_index = uint16_t( fixed );
+      return E;
+    }
+
+    void reap(){
+                                                                                                                              /*
+      Completion thread: submits accumulated entries, waits for completions and resumes
+      processes; finishes when terminated and nothing is in flight:
+                                                                                                                              */
+      for(;;){
+        unsigned submit{ 0 };
+        {
+          std::unique_lock< std::mutex > lock( guard );
+          while( not overflow.empty() and push( overflow.front() ) ) overflow.pop_front();
+          if( inflight == 0 and unsubmitted == 0 ){
+            if( terminate ) return;
+            sleeping = true;
+            bell.wait( lock, [&]{ return terminate or unsubmitted > 0 or not overflow.empty(); } );
+            sleeping = false;
+            while( not overflow.empty() and push( overflow.front() ) ) overflow.pop_front();
+          }
+          submit      = unsubmitted;
+          unsubmitted = 0;
+        }
+        const int r{ ring.enter( submit, inflight + submit > 0 ? 1 : 0, Config::io::FLUSH_PERIOD ) };
+                                                                                                                              /*
+        Kernel returns number of consumed entries if any (errors of operations reported by
+        completions); not consumed ones (e.g. completion ring is full) submitted later:
+                                                                                                                              */
+        const unsigned consumed{ r > 0 ? std::min( unsigned( r ), submit ) : 0u };
+        if( consumed < submit ){ std::lock_guard< std::mutex > lock( guard ); unsubmitted += submit - consumed; }
+        if( consumed ) batches.fetch_add( 1, std::memory_order_relaxed );
+        inflight += consumed;
+        unsigned head{ *ring.cqHead };
+        const unsigned tail{ Ring::load( ring.cqTail ) };
+        for( ; head != tail; head++ ){
+          const io_uring_cqe& C = ring.cqe[ head & *ring.cqMask ];
+          Handle* handle = reinterpret_cast< Handle* >( uintptr_t( C.user_data ) );
+          const int64_t result{ C.res };
+          inflight--;
+          completed.fetch_add( 1, std::memory_order_relaxed );
+          handle->complete( int64_t( result ) );
+        }
+        Ring::store( ring.cqHead, head );
+      }
+    }
+
+    template< typename F > bool offload( Handle& handle, F&& f ){
+      [[maybe_unused]] const unsigned before{ handle.phase.exchange( Handle::PENDING ) };
+      assert( before == Handle::IDLE );
+      submitted.fetch_add( 1, std::memory_order_relaxed ); // :before the job can complete
+      const bool posted{ pool->post( [ this, &handle, f = std::forward< F >( f ) ]{
+        const int64_t r{ f() };
+        const int64_t e{ r < 0 ? -int64_t( errno ) : r };
+        completed.fetch_add( 1, std::memory_order_relaxed );
+        handle.complete( int64_t( e ) );
+      }) };
+      if( not posted ) return cancel( handle ); // :pool stopped
+      return LogicalProcess::block( handle );
+    }
+
+  public:
+
+    explicit AsyncIO( bool uring = true, unsigned entries = Config::io::RING_ENTRIES, unsigned threads = Config::io::THREADS ):
+      ring       {                   },
+      URING      { false             },
+      pool       {                   },
+      guard      {                   },
+      bell       {                   },
+      overflow   {                   },
+      unsubmitted{ 0                 },
+      inflight   { 0                 },
+      sleeping   { false             },
+      terminate  { false             },
+      submitted  { 0                 },
+      completed  { 0                 },
+      batches    { 0                 },
+      reaper     {                   }
+    {
+      URING = uring and ring.open( entries );
+      if( URING ) reaper = std::thread( &AsyncIO::reap, this );
+      else        pool   = std::make_unique< OffloadPool >( threads );
+    }
+
+    AsyncIO( const AsyncIO& )              = delete;
+    AsyncIO& operator = ( const AsyncIO& ) = delete;
+
+    bool     uring  () const { return URING;              } // :io_uring backend, otherwise thread pool
+    uint64_t done   () const { return completed.load();   }
+    uint64_t backlog() const { return submitted.load() - completed.load(); }
+
+    bool enroll( const std::vector< iovec >& buffers ){
+                                                                                                                              /*
+      Register buffers for transfers with `fixed` index (position in `buffers`); replaces
+      previous registration, must be called when nothing in flight:
+                                                                                                                              */
+      if( not URING ) return false;
+      syscall( __NR_io_uring_register, ring.fd, IORING_UNREGISTER_BUFFERS, nullptr, 0 );
+      if( buffers.empty() ) return true;
+      return syscall( __NR_io_uring_register, ring.fd, IORING_REGISTER_BUFFERS, buffers.data(), unsigned( buffers.size() ) ) == 0;
+    }
+
+    bool read( Handle& handle, int fd, void* buffer, size_t size, uint64_t offset, int fixed = -1 ){
+      if( URING ) return enqueue( handle, entry( fixed >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ, fd, buffer, size, offset, fixed, handle ) );
+      return offload( handle, [=]{ return int64_t( pread( fd, buffer, size, off_t( offset ) ) ); } );
+    }
+
+    bool write( Handle& handle, int fd, const void* buffer, size_t size, uint64_t offset, int fixed = -1 ){
+      if( URING ) return enqueue( handle, entry( fixed >= 0 ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE, fd, buffer, size, offset, fixed, handle ) );
+      return offload( handle, [=]{ return int64_t( pwrite( fd, buffer, size, off_t( offset ) ) ); } );
+    }
+
+    bool sync( Handle& handle, int fd ){
+      if( URING ) return enqueue( handle, entry( IORING_OP_FSYNC, fd, nullptr, 0, 0, -1, handle ) );
+      return offload( handle, [=]{ return int64_t( fsync( fd ) ); } );
+    }
+
+    void info( const Log& log ) const {
+      log.vital( kit( "Async I/O: %s, %llu operations done, %llu in flight, %llu batches", URING ? "io_uring" : "thread pool",
+                      (unsigned long long) done(), (unsigned long long) backlog(), (unsigned long long) batches.load() ) );
+    }
+
+    void stop(){
+                                                                                                                              /*
+      Operations submitted already completed (their processes resumed) before return;
+      backend kept, so later requests are cancelled instead of touching closed ring or
+      stopped pool:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( guard );
+        terminate = true;
+      }
+      if( URING ){
+        bell.notify_all();
+        if( reaper.joinable() ) reaper.join();
+        ring.close();
+      }
+      if( pool ) pool->stop();
+    }
+
+   ~AsyncIO(){ stop(); }
+
+  };//AsyncIO
+
+}//namespace CoreAGI
+
+#endif // ASYNC_IO_H_INCLUDED
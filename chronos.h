@@ -7,14 +7,44 @@
 
  2022.01.24  Initial version
 
+ 2026.10.18  Virtual clock: when engaged (see `simulation.h`) Chronos, Timer and pause use
+             virtual time advanced by the simulation instead of the steady clock
+
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef CHRONOS_H_INCLUDED
 #define CHRONOS_H_INCLUDED
 
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 namespace CoreAGI {
+                                                                                                                              /*
+  Process-wide virtual time in nanosec; advanced only by the thread that engaged it
+  (the simulation driver), other threads just read it. Timer keeps the time base it was
+  started with (see `timer.h`); Chronos created earlier counts virtual time from its creation:
+                                                                                                                              */
+  class VirtualClock {
+
+    inline static std::atomic< bool >            active{ false };
+    inline static std::atomic< double >          time  { 0.0   };
+    inline static std::atomic< std::thread::id > owner { {}    };
+
+  public:
+
+    static void engage   (){ owner.store( std::this_thread::get_id() ); active.store( true  ); } // :time continues
+    static void disengage(){ owner.store( std::thread::id{}         ); active.store( false ); }
+
+    static bool   engaged(){ return active.load( std::memory_order_relaxed );                 }
+    static bool   owned  (){ return engaged() and owner.load() == std::this_thread::get_id(); }
+    static double now    (){ return time.load( std::memory_order_relaxed );                   }
+
+    static void advance( double dt ){ if( dt > 0 ) time.store( now() + dt, std::memory_order_relaxed ); }
+    static void set    ( double t  ){ if( t > now() ) time.store( t, std::memory_order_relaxed );       } // :never backward
+
+  };//class VirtualClock
+
 
   class Chronos {
                                                                                                                               /*
@@ -22,9 +52,13 @@ namespace CoreAGI {
                                                                                                                               */
     using Clock = std::chrono::steady_clock;
     const std::chrono::time_point< Clock > to;
+    const double                           vo; // :virtual time of creation
   public:
-    Chronos(): to{ Clock::now() }{}
-    double nanosec() const { return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count(); }
+    Chronos(): to{ Clock::now() }, vo{ VirtualClock::now() }{}
+    double nanosec() const {
+      if( VirtualClock::engaged() ) return VirtualClock::now() - vo;
+      return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count();
+    }
   };//class Chronos
 
 }//namespace CoreAGI
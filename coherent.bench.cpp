@@ -0,0 +1,301 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Parameterized benchmark of Staff + Fluid built from `coherent.cpp`: logical processes
+ read (`check`) or write (`alter`) randomly selected shared objects and block on denied
+ ones; throughput, denial rate and step latency measured for every number of working
+ threads of the sweep, each point repeated with confidence interval of the mean.
+
+ Usage: coherent.bench [ key=value ... ]
+
+   threads=1,2,4      working threads of the sweep (default: powers of 2 up to hardware threads)
+   processes=10       number of logical processes
+   fluids=5           number of shared objects
+   payload=8388608    size of the shared object, bytes
+   reads=0.99         fraction of read steps
+   cost=500           cells of the shared object touched by a step
+   skew=uniform       access distribution over shared objects: `uniform` or `zipf[:exponent]`
+   duration=250       measured interval, millisec
+   warmup=100         interval before measurement, millisec
+   repeat=5           repetitions of every point
+   seed=1             seed of process generators
+   format=text        `text` (log), `csv` or `json`
+   output=FILE        file for `csv` and `json` (default: coherent.bench.csv or coherent.bench.json)
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logger.global.h"
+#include "histogram.h"
+#include "logical.process.h"
+#include "fluid.h"
+#include "staff.h"
+#include "timer.h"
+
+namespace CoreAGI {
+
+  struct Options {
+    std::vector< unsigned > threads;
+    unsigned    processes{ 10      };
+    unsigned    fluids   { 5       };
+    size_t      payload  { 8 << 20 };
+    double      reads    { 0.99    };
+    unsigned    cost     { 500     };
+    double      zipf     { 0.0     }; // :exponent, 0 means uniform
+    unsigned    duration { 250     };
+    unsigned    warmup   { 100     };
+    unsigned    repeat   { 5       };
+    unsigned    seed     { 1       };
+    std::string format   { "text"  };
+    std::string output   {         };
+
+    bool parse( int argc, char* argv[] ){
+      for( int i = 1; i < argc; i++ ){
+        const char* eq = strchr( argv[i], '=' );
+        if( not eq ) return false;
+        const std::string key( argv[i], eq - argv[i] );
+        const char*       value{ eq + 1 };
+        if     ( key == "threads"   ){
+          threads.clear();
+          for( const char* s = value; *s; ){ threads.push_back( unsigned( atoi( s ) ) ); s = strchr( s, ',' ); if( not s ) break; s++; }
+        }
+        else if( key == "processes" ) processes = unsigned( atoi( value ) );
+        else if( key == "fluids"    ) fluids    = std::max( 1, atoi( value ) );
+        else if( key == "payload"   ) payload   = size_t( atoll( value ) );
+        else if( key == "reads"     ) reads     = atof( value );
+        else if( key == "cost"      ) cost      = unsigned( atoi( value ) );
+        else if( key == "skew"      ){
+          if     ( strncmp( value, "zipf", 4 ) == 0 ) zipf = value[4] == ':' ? atof( value + 5 ) : 0.99;
+          else if( strcmp ( value, "uniform" ) == 0 ) zipf = 0.0;
+          else return false;
+        }
+        else if( key == "duration"  ) duration  = unsigned( atoi( value ) );
+        else if( key == "warmup"    ) warmup    = unsigned( atoi( value ) );
+        else if( key == "repeat"    ) repeat    = std::max( 1, atoi( value ) );
+        else if( key == "seed"      ) seed      = unsigned( atoi( value ) );
+        else if( key == "format"    ) format    = value;
+        else if( key == "output"    ) output    = value;
+        else return false;
+      }
+      if( output.empty() ) output = "coherent.bench." + format;
+      if( threads.empty() ) for( unsigned n = 1; n <= std::max( 1u, std::thread::hardware_concurrency() ); n *= 2 ) threads.push_back( n );
+      return true;
+    }
+  };
+                                                                                                                              /*
+  Shared object of run-time size:
+                                                                                                                              */
+  struct Payload {
+    std::vector< uint64_t > cell;
+  };
+                                                                                                                              /*
+  Selection of the shared object: uniform or Zipf distribution by inverse CDF:
+                                                                                                                              */
+  class Skew {
+    std::vector< double > cdf;
+  public:
+    Skew( unsigned n, double exponent ): cdf( n ){
+      double sum{ 0 };
+      for( unsigned i = 0; i < n; i++ ) cdf[i] = ( sum += exponent > 0 ? 1.0/std::pow( i + 1, exponent ) : 1.0 );
+      for( auto& c: cdf ) c /= sum;
+    }
+    unsigned operator()( double u ) const {
+      return unsigned( std::min( size_t( std::lower_bound( cdf.begin(), cdf.end(), u ) - cdf.begin() ), cdf.size() - 1 ) );
+    }
+  };
+                                                                                                                              /*
+  Logical process of `coherent.cpp` with parameters; own generator, step latency
+  recorded only while measurement is on:
+                                                                                                                              */
+  class Worker {
+
+    Fluid< Payload >*          fluid;
+    const Options&             O;
+    const Skew&                skew;
+    const std::atomic< bool >& measuring;
+    uint64_t                   x;       // :xorshift state
+    unsigned                   target;  // :shared object of the current (maybe denied) step
+    bool                       reading;
+    double                     sum;
+
+    uint64_t next(){ x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; }
+    double   unit(){ return double( next() >> 11 )*0x1.0p-53; }
+
+    void choose(){ target = skew( unit() ); reading = unit() < O.reads; }
+
+  public:
+
+    Histogram<> latency;
+
+    Worker( Fluid< Payload >* fluid, const Options& O, const Skew& skew, const std::atomic< bool >& measuring, unsigned seed ):
+      fluid{ fluid }, O{ O }, skew{ skew }, measuring{ measuring }, x{ seed*0x9E3779B97F4A7C15ull + 1 }, target{ 0 }, reading{ true }, sum{ 0 }, latency{}
+    { choose(); }
+
+    bool operator()( [[maybe_unused]] const Log& log ){
+      const bool timed{ measuring.load( std::memory_order_relaxed ) };
+      Timer timer;
+      auto& F = fluid[ target ];
+      bool done;
+      if( reading ) done = F.check( [&]( const Payload& D ){ for( unsigned i = 0; i < O.cost; i++ ) sum += D.cell[ next() % D.cell.size() ]; } );
+      else          done = F.alter( [&]( Payload& D ){ for( unsigned i = 0; i < O.cost; i++ ) D.cell[ next() % D.cell.size() ] = x; } );
+      if( not done ) return LogicalProcess::block( F, reading ? FluidCore::Access::READ : FluidCore::Access::WRITE );
+      if( timed ) latency.record( timer.nsec() );
+      choose();
+      return true;
+    }
+
+  };//Worker
+                                                                                                                              /*
+  Staff with number of members defined at run time:
+                                                                                                                              */
+  class BenchStaff: public StaffCore {
+  public:
+    BenchStaff( const LogicalProcess** PROCESS, unsigned n ): StaffCore( PROCESS, n, n, n, Dispatch::STEALING ){}
+  };
+
+  struct Sample {
+    double rate;   // :successful steps per second
+    double denial; // :fraction of denied steps
+  };
+
+  Sample measure( unsigned threads, const Options& O, const Skew& skew, Fluid< Payload >* fluid, unsigned repetition, Histogram<>& latency ){
+    std::atomic< bool >                              measuring{ false };
+    std::vector< std::unique_ptr< Worker > >         W;
+    std::vector< std::unique_ptr< LogicalProcess > > L;
+    std::vector< const LogicalProcess* >             P;
+    for( unsigned i = 0; i < O.processes; i++ ){
+      W.emplace_back( std::make_unique< Worker >( fluid, O, skew, measuring, O.seed + 7919*repetition + i ) );
+      Worker* w = W.back().get();
+      L.emplace_back( std::make_unique< LogicalProcess >( "W", [w]( const Log& log )->bool{ return ( *w )( log ); } ) );
+      P.push_back( L.back().get() );
+    }
+    P.push_back( nullptr );
+
+    using R = LogicalProcess::Statistics;
+    auto count = [&]( R::RESULT result ){ double n{ 0 }; for( auto& p: L ) n += p->statistics()[ result ]; return n; };
+
+    BenchStaff staff( P.data(), threads );
+    for( auto& p: L ) p->start();
+    staff.start();
+    CoreAGI::pause{ O.warmup }[ MILLISEC ];
+    const double done0{ count( R::DONE ) }, fail0{ count( R::FAIL ) };
+    measuring.store( true );
+    Timer timer;
+    CoreAGI::pause{ O.duration }[ MILLISEC ];
+    const double done1{ count( R::DONE ) }, fail1{ count( R::FAIL ) };
+    const double elapsed{ timer.stop().sec() };
+    measuring.store( false );
+    for( auto& p: L ) p->stop();
+    staff.stop();
+
+    for( auto& w: W ) latency.merge( w->latency );
+    const double done{ done1 - done0 }, fail{ fail1 - fail0 };
+    return Sample{ done/elapsed, done + fail > 0 ? fail/( done + fail ) : 0.0 };
+  }
+                                                                                                                              /*
+  Two-sided 95% Student quantile for `n - 1` degrees of freedom:
+                                                                                                                              */
+  double student( unsigned n ){
+    constexpr double T[]{ 0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                          2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                          2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+    const unsigned df{ n - 1 };
+    return df == 0 ? 0.0 : df <= 30 ? T[ df ] : 1.960;
+  }
+
+  struct Point {
+    unsigned threads;
+    double   rate, ci;       // :mean steps per second and half-width of 95% interval
+    double   denial;
+    double   p50, p99, p999, max; // :step latency, microsec
+  };
+
+  Point point( unsigned threads, const Options& O, const Skew& skew, Fluid< Payload >* fluid ){
+    Histogram<>           latency;
+    std::vector< Sample > S;
+    for( unsigned r = 0; r < O.repeat; r++ ) S.push_back( measure( threads, O, skew, fluid, r, latency ) );
+    double mean{ 0 }, denial{ 0 };
+    for( auto& s: S ){ mean += s.rate; denial += s.denial; }
+    mean /= S.size(); denial /= S.size();
+    double var{ 0 };
+    for( auto& s: S ) var += ( s.rate - mean )*( s.rate - mean );
+    const double sd{ S.size() > 1 ? std::sqrt( var/( S.size() - 1 ) ) : 0.0 };
+    return Point{ threads, mean, student( S.size() )*sd/std::sqrt( double( S.size() ) ), denial,
+                  1.0e-3*latency.quantile( 0.5 ), 1.0e-3*latency.quantile( 0.99 ), 1.0e-3*latency.quantile( 0.999 ), 1.0e-3*latency.max() };
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  Options O;
+  if( not O.parse( argc, argv ) ){
+    fprintf( stderr, "Usage: coherent.bench [ threads=1,2,4 processes= fluids= payload= reads= cost= skew=uniform|zipf[:s] "
+                     "duration= warmup= repeat= seed= format=text|csv|json output= ]\n" );
+    return 1;
+  }
+
+  auto log = logger.log( "bench" );
+  const Skew skew( O.fluids, O.zipf );
+  auto fluid = std::make_unique< Fluid< Payload >[] >( O.fluids );
+  for( unsigned i = 0; i < O.fluids; i++ ) fluid[i].alter( [&]( Payload& D ){ D.cell.assign( std::max( size_t( 1 ), O.payload/sizeof( uint64_t ) ), i ); } );
+
+  const std::string skewName{ O.zipf > 0 ? kit( "zipf:%.2f", O.zipf ) : std::string( "uniform" ) };
+  log.vital( kit( "%u processes, %u fluids of %zu bytes, reads %.3f, cost %u, skew %s, %u+%u millisec x %u",
+                  O.processes, O.fluids, O.payload, O.reads, O.cost, skewName.c_str(), O.warmup, O.duration, O.repeat ) );
+
+  const bool CSV { O.format == "csv"  };
+  const bool JSON{ O.format == "json" };
+  FILE* out{ nullptr };
+  if( CSV or JSON ){
+    out = fopen( O.output.c_str(), "w" );
+    if( not out ){ log.vital( kit( "can`t open %s", O.output.c_str() ) ); return 1; }
+  }
+  if( CSV  ) fprintf( out,  "threads,processes,fluids,payload,reads,cost,skew,duration,repeat,rate,rate_ci95,denial,step_p50_us,step_p99_us,step_p999_us,step_max_us\n" );
+  if( JSON ) fprintf( out, "[\n" );
+  for( unsigned k = 0; k < O.threads.size(); k++ ){
+    const Point p{ point( O.threads[k], O, skew, fluid.get() ) };
+    if( CSV ){
+      fprintf( out, "%u,%u,%u,%zu,%.4f,%u,%s,%u,%u,%.1f,%.1f,%.6f,%.3f,%.3f,%.3f,%.3f\n", p.threads, O.processes, O.fluids, O.payload, O.reads,
+              O.cost, skewName.c_str(), O.duration, O.repeat, p.rate, p.ci, p.denial, p.p50, p.p99, p.p999, p.max );
+    } else if( JSON ){
+      fprintf( out, "  { \"threads\": %u, \"processes\": %u, \"fluids\": %u, \"payload\": %zu, \"reads\": %.4f, \"cost\": %u, \"skew\": \"%s\", "
+              "\"duration\": %u, \"repeat\": %u, \"rate\": %.1f, \"rate_ci95\": %.1f, \"denial\": %.6f, "
+              "\"step_us\": { \"p50\": %.3f, \"p99\": %.3f, \"p999\": %.3f, \"max\": %.3f } }%s\n",
+              p.threads, O.processes, O.fluids, O.payload, O.reads, O.cost, skewName.c_str(), O.duration, O.repeat,
+              p.rate, p.ci, p.denial, p.p50, p.p99, p.p999, p.max, k + 1 < O.threads.size() ? "," : "" );
+    } else {
+      log.vital( kit( "  %3u threads  %12.0f +- %9.0f steps/sec  denied %6.2f %%  step p50 %8.2f  p99 %8.2f  p99.9 %8.2f  max %9.2f us",
+                      p.threads, p.rate, p.ci, 100.0*p.denial, p.p50, p.p99, p.p999, p.max ) );
+    }
+    if( out ){
+      fflush( out );
+      log.vital( kit( "  %3u threads  %12.0f +- %9.0f steps/sec", p.threads, p.rate, p.ci ) );
+    }
+  }
+  if( JSON ) fprintf( out, "]\n" );
+  if( out  ) fclose( out );
+  log.flush();
+
+  CoreAGI::pause{ 100 }[ MILLISEC ];
+
+  return 0;
+}
@@ -8,15 +8,33 @@
 
  2023.05.04  Initial version
 
+ 2026.10.18  Processes block on the Fluid instead of retrying denied access
+
+ 2026.10.18  Logical process defined as coroutine
+
+ 2026.10.18  Deterministic run: `coherent SEED [MEMBERS]` executes processes by Simulation
+             (see `simulation.h`) on virtual time; random generators seeded from SEED
+
+ 2026.10.18  Staff counters published into shared memory segment `/coherent` while running;
+             `coherent.top` shows them live (see `staff.telemetry.h`)
+
+ 2026.10.18  Processes reference their `LogicalProcessAsStructure` bodies (`std::ref`) instead
+             of wrapping them into lambdas
 
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
+#include <cstdlib>
+#include <functional>
 #include <random>
+#include <utility>
 
 #include "logger.global.h"
 #include "logical.process.h"
+#include "coroutine.process.h"
 #include "fluid.h"
+#include "simulation.h"
 #include "staff.h"
+#include "staff.telemetry.h"
 #include "timer.h"
 
 namespace CoreAGI {
@@ -35,6 +53,17 @@ namespace CoreAGI {
 
   Fluid< Data > data[5];
                                                                                                                               /*
+  Seeds of random generators: nondeterministic by default, derived from SEED in
+  deterministic run:
+                                                                                                                              */
+  unsigned SEED{ 0 };
+
+  unsigned seed(){
+    static std::random_device RANDOM_DEVICE;
+    static unsigned           n{ 0 };
+    return SEED ? SEED + n++ : RANDOM_DEVICE();
+  }
+                                                                                                                              /*
   Logical process defined as a function:
                                                                                                                               */
   int LogicalProcessAsFunction( [[maybe_unused]] const Log& log ){
@@ -42,8 +71,7 @@ namespace CoreAGI {
     static double   avg { 0.0 };
     static unsigned step{ 0   };
 
-    static std::random_device RANDOM_DEVICE;
-    static std::mt19937 RANDOM( RANDOM_DEVICE() );
+    static std::mt19937 RANDOM( seed() );
     static std::uniform_int_distribution< int > uniform( 0, 100 );
                                                                                                                     /*
     Function returns randomly 0 or 1 with a average frequency 1000 : 1:
@@ -52,22 +80,24 @@ namespace CoreAGI {
 
     switch( step ){
 
-      case 0: // Data Writing:
+      case 0: { // Data Writing:
+        auto& fluid = data[ rand() % CAPACITY ];
         if(
-          data[ rand() % CAPACITY ].alter( // // Lambda function:
+          fluid.alter( // // Lambda function:
             []( Data& D ){ for( unsigned i = 0; i < 500; i++ ) D.R[ rand()%L ][ rand()%L ] = rand(); }
           )
         ){ // OK, assign next step:
           step = next();
           return true;
-        } else { // Fail, step not changed:
-          return false;
+        } else { // Fail, step not changed; wait until `fluid` released:
+          return LogicalProcess::block( fluid, FluidCore::Access::WRITE );
         }
+      }
 
-      case 1: // Data Reading:
-
+      case 1: { // Data Reading:
+        auto& fluid = data[ rand() % CAPACITY ];
         if(
-          data[ rand() % CAPACITY ].check( // Lambda function:
+          fluid.check( // Lambda function:
             [&]( const Data& D ){
               constexpr unsigned M{ 50 };
               avg = 0.0;
@@ -78,9 +108,10 @@ namespace CoreAGI {
         ){ // OK, assign next step:
           step = next();
           return true;
-        } else {  // Fail, step not changed:
-          return false;
+        } else {  // Fail, step not changed; wait until `fluid` released:
+          return LogicalProcess::block( fluid, FluidCore::Access::READ );
         }
+      }
 
       default: assert( false );
 
@@ -109,8 +140,7 @@ namespace CoreAGI {
 
     int operator()( [[maybe_unused]] const Log& log ){
 
-      static std::random_device RANDOM_DEVICE;
-      static std::mt19937 RANDOM( RANDOM_DEVICE() );
+      static std::mt19937 RANDOM( seed() );
       static std::uniform_int_distribution< int > uniform( 0, 100 );
 
       auto next = [&]()->unsigned { return uniform( RANDOM ) ? 1 : 0; };
@@ -119,12 +149,13 @@ namespace CoreAGI {
                                                                                                                               */
       switch( state ){
 
-        case 0:
+        case 0: {
+          auto& fluid = data[ rand() % CAPACITY ];
           if(
                                                                                                                               /*
             Try to get `write` access to shared data and modify data:
                                                                                                                               */
-            data[ rand() % CAPACITY ].alter(
+            fluid.alter(
               []( Data& D ){ for( unsigned i = 0; i < 500; i++ ) D.R[ rand()%L ][ rand()%L ] = rand(); }
             )
           )[[ unlikely ]]{ // OK, do something more and assign next state:
@@ -134,16 +165,18 @@ namespace CoreAGI {
                                                                                                                               */
             state = next();
             return true;
-          } else { // Can`t get `write` access to shared data, state sill uncheged, no more activity:
-            return false;
+          } else { // Can`t get `write` access to shared data, state sill uncheged, wait for release:
+            return LogicalProcess::block( fluid, FluidCore::Access::WRITE );
           }//if
+        }
 
-        case 1:
+        case 1: {
+          auto& fluid = data[ rand() % CAPACITY ];
           if(
                                                                                                                               /*
             Try to get `read` access to shared data and calculate `avg` using shared data:
                                                                                                                               */
-            data[ rand() % CAPACITY ].check(
+            fluid.check(
               [&]( const Data& D ){
                 constexpr unsigned M{ 50 };
                 avg = 0.0;
@@ -158,9 +191,10 @@ namespace CoreAGI {
                                                                                                                               */
             state = next();
             return true;
-          } else { // Can`t get `read` access to shared data, state sill uncheged, no more activity:
-            return false;
+          } else { // Can`t get `read` access to shared data, state sill uncheged, wait for release:
+            return LogicalProcess::block( fluid, FluidCore::Access::READ );
           }//if
+        }
 
       default: assert( false );
 
@@ -170,10 +204,42 @@ namespace CoreAGI {
 
   };//LogicalProcessAsStructure
 
+                                                                                                                              /*
+  The same logical process defined as coroutine: states are points of suspension:
+                                                                                                                              */
+  Routine LogicalProcessAsCoroutine(){
+
+    std::mt19937 RANDOM( seed() );
+    std::uniform_int_distribution< int > uniform( 0, 100 );
+
+    double avg{ 0.0 };
+
+    for(;;){
+      while( uniform( RANDOM ) ){ // Data Writing:
+        {
+          auto D = co_await data[ rand() % CAPACITY ].write();
+          for( unsigned i = 0; i < 500; i++ ) D->R[ rand()%L ][ rand()%L ] = rand();
+        }
+        co_await yield();
+      }
+      while( uniform( RANDOM ) ){ // Data Reading:
+        {
+          auto D = co_await std::as_const( data[ rand() % CAPACITY ] ).read();
+          constexpr unsigned M{ 50 };
+          avg = 0.0;
+          for( unsigned i = 0; i < M; i++ ) avg += D->R[ rand()%L ][ rand()%L ];
+          avg /= double( M );
+        }
+        co_await yield();
+      }
+    }
+
+  }//LogicalProcessAsCoroutine
+
 }//namespace CoreAGI
 
 
-int main(){
+int main( int argc, char* argv[] ){
 
   using namespace CoreAGI;
                                                                                                                               /*
@@ -186,33 +252,62 @@ int main(){
                                                                                                                               */
   LogicalProcessAsStructure S[9];
                                                                                                                               /*
-  Creation of the 10 logical processes accessible from working threads:
+  Creation of the 11 logical processes accessible from working threads:
                                                                                                                               */
-  LogicalProcess Pf( "F", LogicalProcessAsFunction                            );
-  LogicalProcess Pi( "I", [&]( const Log& log )->bool{ return S[0]( log ); }  );
-  LogicalProcess Pj( "J", [&]( const Log& log )->bool{ return S[1]( log ); }  );
-  LogicalProcess Pk( "K", [&]( const Log& log )->bool{ return S[2]( log ); }  );
-  LogicalProcess Pu( "U", [&]( const Log& log )->bool{ return S[3]( log ); }  );
-  LogicalProcess Pv( "V", [&]( const Log& log )->bool{ return S[4]( log ); }  );
-  LogicalProcess Pw( "W", [&]( const Log& log )->bool{ return S[5]( log ); }  );
-  LogicalProcess Px( "X", [&]( const Log& log )->bool{ return S[6]( log ); }  );
-  LogicalProcess Py( "Y", [&]( const Log& log )->bool{ return S[7]( log ); }  );
-  LogicalProcess Pz( "Z", [&]( const Log& log )->bool{ return S[8]( log ); }  );
+  LogicalProcess Pf( "F", LogicalProcessAsFunction );
+  LogicalProcess Pi( "I", std::ref( S[0] ) );
+  LogicalProcess Pj( "J", std::ref( S[1] ) );
+  LogicalProcess Pk( "K", std::ref( S[2] ) );
+  LogicalProcess Pu( "U", std::ref( S[3] ) );
+  LogicalProcess Pv( "V", std::ref( S[4] ) );
+  LogicalProcess Pw( "W", std::ref( S[5] ) );
+  LogicalProcess Px( "X", std::ref( S[6] ) );
+  LogicalProcess Py( "Y", std::ref( S[7] ) );
+  LogicalProcess Pz( "Z", std::ref( S[8] ) );
+                                                                                                                              /*
+  Logical process defined as coroutine:
+                                                                                                                              */
+  CoroutineProcess Pc( "C", LogicalProcessAsCoroutine );
                                                                                                                               /*
   Make array of pointers to logical processes ended by null pointer:
                                                                                                                               */
-  const LogicalProcess* P[]{ &Pf, &Pi, &Pj, &Pk, &Pu, &Pv, &Pw, &Px, &Py, &Pz, nullptr };
+  const LogicalProcess* P[]{ &Pf, &Pi, &Pj, &Pk, &Pu, &Pv, &Pw, &Px, &Py, &Pz, &Pc, nullptr };
 
   unsigned n{ 0 };
   while( P[n] ) n++;
   log.vital( kit( "%i logical processes", n ) );
                                                                                                                               /*
+  Deterministic run: the same SEED reproduces the same schedule (compare digests):
+                                                                                                                              */
+  if( argc > 1 ){
+    SEED = unsigned( atoi( argv[1] ) );
+    srand( SEED );
+    const unsigned members( argc > 2 ? atoi( argv[2] ) : 2 );
+    for( unsigned i = 0; i < n; i++ ) P[i]->start();
+    Simulation simulation( P, SEED, members );
+    simulation.run( log, Duration::Value{ 250.0 }[ MILLISEC ] );
+    for( unsigned i = 0; i < n; i++ ){
+      P[i]->stop();
+      P[i]->info( log );
+    }
+    log.vital( "R/W statistics:" );
+    for( auto& Si: S ) log.vital( kit( "%5u R  %5u W", Si.Nr, Si.Nw ) );
+    simulation.info( log );
+    return 0;
+  }
+                                                                                                                              /*
   Creation of the `staff` ~ set of 2 working threads:
                                                                                                                               */
   constexpr unsigned STAFF{ 2 };
   Staff< STAFF > staff( P );
   staff.start();
                                                                                                                               /*
+  Publish live counters of members, processes and Fluids (see `coherent.top`):
+                                                                                                                              */
+  TelemetryPublisher telemetry( staff );
+  for( unsigned i = 0; i < CAPACITY; i++ ) telemetry.watch( kit( "data[%u]", i ), data[i] );
+  telemetry.start();
+                                                                                                                              /*
   Allow processed to be executed:
                                                                                                                               */
   for( unsigned i = 0; i < n; i++ ){
@@ -236,6 +331,7 @@ int main(){
                                                                                                                               /*
   Stop working threads and finish:
                                                                                                                               */
+  telemetry.stop();
   staff.stop();
 
   CoreAGI::pause( 100 )[ MILLISEC ];
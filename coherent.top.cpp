@@ -0,0 +1,151 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ coherent-top: live view of the telemetry published by running Staff (see `telemetry.h`
+ and `staff.telemetry.h`). Maps the segment read-only, takes consistent snapshots and
+ shows rates computed between consecutive snapshots:
+
+   members    engaged flag, CPU, steps/sec by result, DONE fraction, awake fraction
+   processes  DONE/sec, denied (FAIL) fraction, parked steps/sec, LATE and OVER counts,
+              step duration and dispatch delay quantiles
+   Fluids     automaton state, readers inside, parked waiters, denials/sec
+
+ Usage: coherent.top [ key=value ... ]
+
+   segment=/coherent  shared memory object name
+   period=1000        refresh period, millisec
+   count=0            number of refreshes, 0 means `until interrupted`
+   top=20             processes shown (the busiest by DONE rate)
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "color.h"
+#include "telemetry.h"
+
+namespace CoreAGI {
+
+  void show( const Telemetry& T, const Telemetry& B, unsigned top ){
+                                                                                                                              /*
+    `T` is the current snapshot, `B` the previous one (serial 0 if none):
+                                                                                                                              */
+    const double span{ B.serial ? 1.0e-9*double( T.published - B.published ) : 0.0 };
+    auto rate = [&]( uint64_t now, uint64_t before ){ return span > 0 ? double( now - std::min( now, before ) )/span : 0.0; };
+    const double age{ 1.0e-6*double( Telemetry::clock() - T.published ) };
+
+    printf( "\u001b[H\u001b[2J" );
+    printf( "%scoherent-top%s  publisher %llu  publication %llu  age %.0f ms%s\n\n", xWHITE, RESET,
+            (unsigned long long) T.publisher, (unsigned long long) T.serial, age,
+            age > 3.0*T.period ? "  (stale)" : "" );
+
+    printf( "%s%-10s %3s %4s %11s %11s %11s %11s %7s %7s%s\n", CYAN,
+            "MEMBER", "ON", "CPU", "idle/s", "busy/s", "done/s", "fail/s", "done%", "awake%", RESET );
+    for( unsigned i = 0; i < T.workers; i++ ){
+      const Telemetry::Worker& W = T.worker[i];
+      const Telemetry::Worker* P = i < B.workers ? &B.worker[i] : nullptr;
+      double r[4];
+      for( unsigned j = 0; j < 4; j++ ) r[j] = P ? rate( W.count[j], P->count[j] ) : 0.0;
+      const double total{ r[0] + r[1] + r[2] + r[3] };
+      const double dozed{ P and span > 0 ? 1.0e-9*double( W.dozed - std::min( W.dozed, P->dozed ) )/span : 0.0 };
+      if( not W.engaged and total == 0 ) continue;
+      printf( "%-10s %3s %4i %11.0f %11.0f %11.0f %11.0f %7.1f %7.1f\n", W.name, W.engaged ? "*" : "", W.cpu,
+              r[0], r[1], r[2], r[3], total > 0 ? 100.0*r[2]/total : 0.0, 100.0*( 1.0 - std::min( 1.0, dozed ) ) );
+    }
+
+    struct Row { const Telemetry::Process* p; double done, fail, wait; };
+    std::vector< Row > rows;
+    for( unsigned i = 0; i < T.processes; i++ ){
+      const Telemetry::Process& p = T.process[i];
+      const Telemetry::Process* b{ nullptr };
+      if( i < B.processes and strcmp( B.process[i].name, p.name ) == 0 ) b = &B.process[i];
+      else for( unsigned k = 0; k < B.processes and not b; k++ ) if( strcmp( B.process[k].name, p.name ) == 0 ) b = &B.process[k];
+      rows.push_back( Row{ &p, b ? rate( p.count[2], b->count[2] ) : 0.0, b ? rate( p.count[3], b->count[3] ) : 0.0,
+                                b ? rate( p.count[6], b->count[6] ) : 0.0 } );
+    }
+    std::stable_sort( rows.begin(), rows.end(), []( const Row& a, const Row& b ){ return a.done > b.done; } );
+    printf( "\n%s%-20s %2s %11s %6s %9s %8s %8s %9s %9s %9s %9s%s\n", CYAN, "PROCESS", "", "done/s", "fail%", "wait/s",
+            "late", "over", "step p50", "step p99", "delay p99", "delay max", RESET );
+    for( unsigned i = 0; i < rows.size() and i < top; i++ ){
+      const Row& r = rows[i];
+      const Telemetry::Process& p = *r.p;
+      printf( "%-20.20s %2s %11.0f %6.2f %9.0f %8llu %8llu %9.1f %9.1f %9.1f %9.1f\n", p.name,
+              p.parked ? "P" : ( p.live ? "" : "-" ), r.done, r.done + r.fail > 0 ? 100.0*r.fail/( r.done + r.fail ) : 0.0,
+              r.wait, (unsigned long long) p.count[4], (unsigned long long) p.count[5],
+              1.0e-3*p.step[0], 1.0e-3*p.step[1], 1.0e-3*p.delay[1], 1.0e-3*p.delay[2] );
+    }
+    if( rows.size() > top ) printf( "... %u more\n", unsigned( rows.size() - top ) );
+
+    if( T.fluids > 0 ){
+      printf( "\n%s%-20s %5s %7s %7s %11s %12s%s\n", CYAN, "FLUID", "STATE", "readers", "parked", "denied/s", "denied", RESET );
+      for( unsigned i = 0; i < T.fluids; i++ ){
+        const Telemetry::Fluid& F = T.fluid[i];
+        const bool   known{ i < B.fluids and strcmp( B.fluid[i].name, F.name ) == 0 };
+        printf( "%-20.20s %5c %7u %7u %11.0f %12llu\n", F.name, F.state, F.readers, F.parked,
+                known ? rate( F.denied, B.fluid[i].denied ) : 0.0, (unsigned long long) F.denied );
+      }
+    }
+    printf( "\nstep and delay in microsec; P - parked, '-' - inactive\n" );
+    fflush( stdout );
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  std::string SEGMENT{ Config::telemetry::SEGMENT };
+  unsigned    PERIOD{ 1000 }, COUNT{ 0 }, TOP{ 20 };
+  for( int i = 1; i < argc; i++ ){
+    const char* eq = strchr( argv[i], '=' );
+    const std::string key( argv[i], eq ? eq - argv[i] : strlen( argv[i] ) );
+    const char* value{ eq ? eq + 1 : "" };
+    if     ( key == "segment" ) SEGMENT = value;
+    else if( key == "period"  ) PERIOD  = std::max( 10, atoi( value ) );
+    else if( key == "count"   ) COUNT   = unsigned( atoi( value ) );
+    else if( key == "top"     ) TOP     = unsigned( atoi( value ) );
+    else {
+      fprintf( stderr, "Usage: coherent.top [ segment=/coherent period=1000 count=0 top=20 ]\n" );
+      return 1;
+    }
+  }
+
+  TelemetrySegment segment( SEGMENT.c_str(), false );
+  if( not segment ){
+    fprintf( stderr, "coherent.top: no telemetry segment `%s` (publisher not running?)\n", SEGMENT.c_str() );
+    return 1;
+  }
+                                                                                                                              /*
+  Snapshots are large (all capacity), so they live on the heap:
+                                                                                                                              */
+  auto current  = std::make_unique< Telemetry >();
+  auto previous = std::make_unique< Telemetry >();
+  for( unsigned n = 0; COUNT == 0 or n < COUNT; n++ ){
+    if( segment->snapshot( *current ) ){
+      if( current->serial != previous->serial ){
+        show( *current, *previous, TOP );
+        std::swap( current, previous );
+      }
+    } else {
+      fprintf( stderr, "coherent.top: no consistent snapshot\n" );
+    }
+    if( COUNT == 0 or n + 1 < COUNT ) usleep( 1000*PERIOD );
+  }
+  return 0;
+}
@@ -20,7 +20,7 @@ namespace CoreAGI {
       constexpr unsigned    LOGGER_QUEUE_CAPACITY  { 4096 };
       constexpr unsigned    CHANNEL_QUEUE_CAPACITY {  512 };
       constexpr unsigned    CHANNEL_NAME_CAPACITY  {   16 }; // :including End-Of-Line symbol
-      constexpr unsigned    CHANNEL_CAPACITY       {   48 }; // :max number of channels
+      constexpr unsigned    CHANNEL_CAPACITY       {   96 }; // :max number of channels (one per Staff member)
       constexpr unsigned    FORMAT_CAPACITY        {   64 }; // :max length of record format
       constexpr unsigned    PATH_CAPACITY          {  256 }; // :max length of log file path
       constexpr unsigned    NO_JOB_PAUSE           {   50 }; // :pause at `no request` situation, millisec     // [+] 2021.06.08
@@ -29,6 +29,50 @@ namespace CoreAGI {
 
     }
 
+    namespace staff {
+      constexpr unsigned    DEQUE_CAPACITY         { 1024 }; // :max number of processes in worker`s deque, power of 2
+      constexpr unsigned    STEAL_ATTEMPTS         {    4 }; // :random victims probed before yield
+      constexpr unsigned    REBALANCE_PERIOD       {   64 }; // :member iterations between steals while own deque is not empty
+      constexpr unsigned    GOVERNOR_PERIOD        {  100 }; // :ElasticStaff utilization sampling period, millisec
+      constexpr double      ENGAGE_UTILIZATION     { 0.85 }; // :engage one more member above this DONE fraction
+      constexpr double      DISENGAGE_UTILIZATION  { 0.40 }; // :disengage one member below this DONE fraction
+      constexpr double      ENGAGE_GAIN            { 1.05 }; // :min DONE rate gain that justifies engaged member
+      constexpr unsigned    GOVERNOR_HOLD          {   10 }; // :periods without engagement after useless one
+      constexpr unsigned    WHEEL_TICK             {  100 }; // :timing wheel resolution, microsec
+      constexpr unsigned    WHEEL_POLL             {   16 }; // :member iterations between timing wheel polls
+      constexpr unsigned    IDLE_SPINS             {   64 }; // :idle iterations before member dozes
+      constexpr unsigned    IDLE_DOZE              { 1000 }; // :max doze of idle member, microsec
+      constexpr unsigned    WATCHDOG_PERIOD        {    2 }; // :step watchdog sampling period, millisec
+      constexpr unsigned    WATCHDOG_BUDGET        { 5000 }; // :step budget of process without own one, microsec
+      constexpr unsigned    OFFLOAD_THREADS        {    4 }; // :default size of the blocking offload pool
+      constexpr bool        LOCALITY               { true  }; // :soft affinity and co-location by Fluid (STEALING dispatch)
+      constexpr unsigned    COLOCATE_STREAK        {    4 }; // :consecutive steps on the same Fluid before co-location
+      constexpr unsigned    COLOCATE_SLACK         {    2 }; // :max excess of target member queue over own one
+      constexpr unsigned    TASK_CAPACITY          { 4096 }; // :max number of fork-join tasks in worker`s deque, power of 2
+      constexpr unsigned    ARENA_BLOCK            {   64 }; // :chunk of worker`s scratch arena, KiB
+      constexpr unsigned    ARENA_RETAIN           { 1024 }; // :max scratch arena memory kept between steps, KiB
+    }
+
+    namespace io {
+      constexpr unsigned    RING_ENTRIES           {  256 }; // :io_uring submission queue size, power of 2
+      constexpr unsigned    FLUSH_PERIOD           {   50 }; // :max delay of submission while requests in flight, microsec
+      constexpr unsigned    THREADS                {    4 }; // :threads of fallback pool (no io_uring)
+    }
+
+    namespace statistics {
+      constexpr unsigned    SHARD_CAPACITY         {  128 }; // :counter shards per Statistics, power of 2
+      constexpr bool        TIMING                 { true }; // :latency histograms of every step (else of timed processes only)
+    }
+
+    namespace telemetry {
+      constexpr const char* SEGMENT                { "/coherent" }; // :POSIX shared memory object name
+      constexpr unsigned    PERIOD                 {  250 }; // :publication period, millisec
+      constexpr unsigned    WORKER_CAPACITY        {  128 }; // :max members published
+      constexpr unsigned    PROCESS_CAPACITY       { 1024 }; // :max processes published
+      constexpr unsigned    FLUID_CAPACITY         {  256 }; // :max Fluids published
+      constexpr unsigned    NAME_CAPACITY          {   32 }; // :including End-Of-Line symbol
+    }
+
   }//namespace Config
 
 }//namespace CoreAGI
@@ -0,0 +1,271 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Logical process defined as C++20 coroutine: instead of the explicit state machine
+ (see `coherent.cpp`) the process body is a sequential code; every resumption of the
+ coroutine is one step of the logical process:
+
+   CoroutineProcess P( "P", [&]()->Routine {
+     for(;;){
+       {
+         auto D = co_await fluid.write();      // :suspends (process parked) until access granted
+         D->value++;
+       }                                       // :access released
+       co_await after( Duration::Value{ 1.0 }[ MILLISEC ] );
+       co_await yield();                       // :end of step
+     }
+   });
+
+ Denied access suspends the coroutine and blocks the process on the Fluid (see
+ `LogicalProcess::block`); the process resumed by Staff when access released, the access
+ acquired before the coroutine resumed. Access is held by `Holding` until it destroyed.
+
+ Coroutine frames are allocated once per process from `FramePool` that reuses freed
+ frames, resumptions allocate nothing.
+
+ Lambda that produces coroutine must not be a temporary: captures of the lambda live in
+ the lambda object, not in the coroutine frame; so `CoroutineProcess` keeps it.
+
+ 2026.10.18  Initial version
+
+ 2026.10.18  Sleeping coroutine postpones the next step of the process (see `LogicalProcess::scheduleAt`)
+             instead of polling the time
+
+ 2026.10.18  Step entered directly (see `LogicalProcess::Step`), without `std::function` wrapper
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef COROUTINE_PROCESS_H_INCLUDED
+#define COROUTINE_PROCESS_H_INCLUDED
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "fluid.h"
+#include "logical.process.h"
+
+namespace CoreAGI {
+                                                                                                                              /*
+  Pool of coroutine frames: size classes of GRANULE bytes, freed frames kept for reuse;
+  frames larger than LIMIT allocated directly:
+                                                                                                                              */
+  class FramePool {
+
+    static constexpr size_t GRANULE{  64 };
+    static constexpr size_t CLASSES{  64 };
+    static constexpr size_t LIMIT  { GRANULE*CLASSES };
+
+    std::mutex            lock;
+    std::vector< void* >  vacant[ CLASSES ];
+
+    static size_t sizeClass( size_t n ){ return ( n + GRANULE - 1 )/GRANULE - 1; }
+
+  public:
+
+    FramePool(): lock{}, vacant{}{}
+
+    FramePool( const FramePool& )              = delete;
+    FramePool& operator = ( const FramePool& ) = delete;
+
+    static FramePool& shared(){
+      static FramePool pool;
+      return pool;
+    }
+
+    void* allocate( size_t n ){
+      if( n > LIMIT ) return ::operator new( n );
+      const size_t c{ sizeClass( n ) };
+      {
+        std::lock_guard< std::mutex > guard( lock );
+        if( not vacant[c].empty() ){ void* p = vacant[c].back(); vacant[c].pop_back(); return p; }
+      }
+      return ::operator new( ( c + 1 )*GRANULE );
+    }
+
+    void deallocate( void* p, size_t n ){
+      if( n > LIMIT ){ ::operator delete( p ); return; }
+      std::lock_guard< std::mutex > guard( lock );
+      vacant[ sizeClass( n ) ].push_back( p );
+    }
+
+   ~FramePool(){
+      for( auto& V: vacant ) for( void* p: V ) ::operator delete( p );
+    }
+
+  };//FramePool
+
+                                                                                                                              /*
+  Coroutine type of the process body:
+                                                                                                                              */
+  class Routine {
+  public:
+
+    struct promise_type {
+
+      const FluidCore*   claimed{ nullptr };                  // :Fluid the coroutine waits for
+      FluidCore::Access  access { FluidCore::Access::WRITE };
+      Timepoint          wakeup {};                           // :coroutine suspended until this time
+      std::exception_ptr failure{};
+
+      Routine get_return_object(){ return Routine( std::coroutine_handle< promise_type >::from_promise( *this ) ); }
+
+      std::suspend_always initial_suspend() noexcept { return {}; } // :body started by the first step
+      std::suspend_always final_suspend  () noexcept { return {}; } // :frame destroyed by `Routine`
+
+      void return_void(){}
+      void unhandled_exception(){ failure = std::current_exception(); }
+
+      static void* operator new   ( size_t n          ){ return FramePool::shared().allocate( n ); }
+      static void  operator delete( void* p, size_t n ){ FramePool::shared().deallocate( p, n ); }
+
+    };//promise_type
+
+    using Handle = std::coroutine_handle< promise_type >;
+
+  private:
+
+    Handle handle;
+
+  public:
+
+    explicit Routine( Handle h ): handle{ h }{}
+
+    Routine( Routine&& R ): handle{ R.handle }{ R.handle = nullptr; }
+    Routine( const Routine& )              = delete;
+    Routine& operator = ( const Routine& ) = delete;
+
+    bool          done   () const { return not handle or handle.done(); }
+    promise_type& promise() const { return handle.promise(); }
+    void          resume () const { handle.resume(); }
+
+   ~Routine(){ if( handle ) handle.destroy(); }
+
+  };//Routine
+
+                                                                                                                              /*
+  Access to the shared object granted to the coroutine; returned when destroyed:
+                                                                                                                              */
+  template< typename Data > class Holding {
+
+    const FluidCore* fluid;
+    Data*            data;
+
+  public:
+
+    Holding( const FluidCore* fluid, Data* data ): fluid{ fluid }, data{ data }{}
+    Holding( Holding&& H ): fluid{ H.fluid }, data{ H.data }{ H.fluid = nullptr; }
+
+    Holding( const Holding& )              = delete;
+    Holding& operator = ( const Holding& ) = delete;
+
+    Data& operator *  () const { assert( fluid ); return *data; }
+    Data* operator -> () const { assert( fluid ); return  data; }
+
+    void release(){ if( fluid ) fluid->release(); fluid = nullptr; }
+
+   ~Holding(){ release(); }
+
+  };//Holding
+
+                                                                                                                              /*
+  Awaiters:
+                                                                                                                              */
+  template< typename Data > struct Acquisition {
+
+    Claim< Data > claim;
+
+    bool await_ready(){ return claim.fluid->acquire( claim.access ); }
+
+    void await_suspend( Routine::Handle h ){
+                                                                                                                              /*
+      Denied: the step finished by blocking on the Fluid, access acquired by the process
+      before the coroutine resumed (see `CoroutineProcess::step`):
+                                                                                                                              */
+      h.promise().claimed = claim.fluid;
+      h.promise().access  = claim.access;
+      LogicalProcess::block( *claim.fluid, claim.access );
+    }
+
+    Holding< Data > await_resume(){ return Holding< Data >( claim.fluid, claim.data ); }
+
+  };//Acquisition
+
+  template< typename Data > Acquisition< Data > operator co_await( Claim< Data > claim ){ return { claim }; }
+
+
+  struct Postponement {
+
+    Timepoint wakeup;
+
+    explicit Postponement( const Timepoint& t ): wakeup{ t }{}
+
+    bool await_ready() const { return LogicalProcess::now() >= wakeup; }
+    void await_suspend( Routine::Handle h ) const { h.promise().wakeup = wakeup; LogicalProcess::scheduleAt( wakeup ); }
+    void await_resume () const {}
+
+  };//Postponement
+
+  Postponement until( const Timepoint& t ){ return Postponement( t                         ); } // :suspend until time point
+  Postponement after( const Duration&  d ){ return Postponement( LogicalProcess::now() + d ); } // :suspend for duration
+
+  std::suspend_always yield(){ return {}; } // :finish current step
+
+                                                                                                                              /*
+  Logical process that executes coroutine; finished coroutine makes process inactive:
+                                                                                                                              */
+  class CoroutineProcess: public LogicalProcess {
+
+    std::function< Routine() > body;
+    Routine                    routine;
+
+    inline static thread_local const Log* current{ nullptr };
+
+    bool step( const Log& log ){
+      auto& promise = routine.promise();
+      if( routine.done() ){ stop(); return true; }
+                                                                                                                              /*
+      Coroutine waits for access: acquire it or block again without resuming:
+                                                                                                                              */
+      if( promise.claimed ){
+        if( not promise.claimed->acquire( promise.access ) ) return block( *promise.claimed, promise.access );
+        promise.claimed = nullptr;
+      }
+                                                                                                                              /*
+      Coroutine sleeps: time not reached yet, nothing to do at this step:
+                                                                                                                              */
+      if( promise.wakeup.nsec() > 0 ){
+        if( now() < promise.wakeup ) return true;
+        promise.wakeup = Timepoint{};
+      }
+      current = &log;
+      routine.resume();
+      current = nullptr;
+      if( promise.failure ) std::rethrow_exception( promise.failure );
+      return not promise.claimed; // :`false` means blocked on the claimed Fluid
+    }
+
+    static bool advance( void* process, const Log& log ){ return static_cast< CoroutineProcess* >( process )->step( log ); }
+
+  public:
+
+    CoroutineProcess( const char* name, std::function< Routine() > f ):
+      LogicalProcess( name, Step{ &advance, this } ),
+      body   { f      },
+      routine{ body() }
+    {}
+
+    static const Log& log(){ assert( current ); return *current; } // :log of the thread executing the coroutine
+
+  };//CoroutineProcess
+
+}//namespace CoreAGI
+
+#endif // COROUTINE_PROCESS_H_INCLUDED
@@ -0,0 +1,101 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Number of CPU actually available for the process: minimum of the affinity mask
+ size and CPU quota of the cgroup (v2 `cpu.max` or v1 `cpu.cfs_quota_us`).
+ Inside a container `std::thread::hardware_concurrency()` reports host cores,
+ that is usually much more than the container allowed to use.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef CPU_H_INCLUDED
+#define CPU_H_INCLUDED
+
+#include <sched.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <thread>
+
+namespace CoreAGI::cpu {
+
+  unsigned affinity(){
+                                                                                                                              /*
+    Number of CPU in the affinity mask of the calling thread:
+                                                                                                                              */
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    if( sched_getaffinity( 0, sizeof( set ), &set ) != 0 ) return std::max( 1u, std::thread::hardware_concurrency() );
+    return std::max( 1, CPU_COUNT( &set ) );
+  }
+
+  double quota(){
+                                                                                                                              /*
+    CPU quota (in CPU units) of the process` cgroup; infinity if not limited or unknown.
+    Own cgroup v2 path taken from the `/proc/self/cgroup` line `0::/path`:
+                                                                                                                              */
+    constexpr double UNLIMITED{ std::numeric_limits< double >::infinity() };
+
+    auto cgroup = []()->std::string {
+      char line[ 512 ];
+      std::string path;
+      if( FILE* f = fopen( "/proc/self/cgroup", "r" ) ){
+        while( fgets( line, sizeof( line ), f ) ){
+          if( strncmp( line, "0::", 3 ) == 0 ){
+            path = line + 3;
+            while( not path.empty() and ( path.back() == '\n' or path.back() == '/' ) ) path.pop_back();
+            break;
+          }
+        }
+        fclose( f );
+      }
+      return path;
+    };
+                                                                                                                              /*
+    cgroup v2: `cpu.max` contains "<quota> <period>" or "max <period>":
+                                                                                                                              */
+    const std::string V2[]{ "/sys/fs/cgroup" + cgroup() + "/cpu.max", "/sys/fs/cgroup/cpu.max" };
+    for( const auto& path: V2 ){
+      if( FILE* f = fopen( path.c_str(), "r" ) ){
+        char   q[ 32 ]{ 0 };
+        double period{ 0 };
+        const int n = fscanf( f, "%31s %lf", q, &period );
+        fclose( f );
+        if( n != 2 ) continue;
+        if( strcmp( q, "max" ) == 0 or period <= 0 ) return UNLIMITED;
+        return atof( q )/period;
+      }
+    }
+                                                                                                                              /*
+    cgroup v1: quota -1 means `not limited`:
+                                                                                                                              */
+    double q{ -1 }, period{ 0 };
+    if( FILE* f = fopen( "/sys/fs/cgroup/cpu/cpu.cfs_quota_us",  "r" ) ){ if( fscanf( f, "%lf", &q      ) != 1 ) q      = -1; fclose( f ); }
+    if( FILE* f = fopen( "/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r" ) ){ if( fscanf( f, "%lf", &period ) != 1 ) period =  0; fclose( f ); }
+    if( q > 0 and period > 0 ) return q/period;
+    return UNLIMITED;
+  }
+
+  unsigned available(){
+                                                                                                                              /*
+    Number of worker threads that can run simultaneously without throttling:
+                                                                                                                              */
+    const double   Q{ quota()    };
+    const unsigned A{ affinity() };
+    if( std::isinf( Q ) ) return A;
+    return std::clamp( unsigned( std::ceil( Q ) ), 1u, A );
+  }
+
+}//namespace CoreAGI::cpu
+
+#endif // CPU_H_INCLUDED
@@ -0,0 +1,119 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+________________________________________________________________________________________________________________________________
+
+  Work-stealing double-ended queue (Chase-Lev deque) of fixed capacity.
+
+  Owner thread pushes and pops elements at the `bottom` end (LIFO order, that keeps
+  recently used data warm in the owner`s cache); any other thread can steal the oldest
+  element from the `top` end. Implementation follows
+
+    N.M. Le, A. Pop, A. Cohen, F. Zappa Nardelli
+    "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013
+
+  with circular buffer of fixed size instead of growable one.
+
+  Note: `Elem` should be trivially copyable (pointer, index and so on).
+
+  2026.10.18 Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef DEQUE_H_INCLUDED
+#define DEQUE_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+
+#include <atomic>
+#include <type_traits>
+
+namespace CoreAGI {
+
+  template< typename Elem, unsigned CAPACITY > class Deque {
+
+    static_assert( CAPACITY > 0 and ( CAPACITY & ( CAPACITY - 1 ) ) == 0, "capacity should be power of 2" );
+    static_assert( std::is_trivially_copyable_v< Elem > );
+
+    static constexpr int64_t MASK{ CAPACITY - 1 };
+
+                  const Elem             NIHIL;
+    alignas( 64 ) std::atomic< int64_t > top;    // :steal end
+    alignas( 64 ) std::atomic< int64_t > bottom; // :owner end
+    alignas( 64 ) std::atomic< Elem >    seq[ CAPACITY ];
+
+  public:
+
+    Deque( const Elem& nihil = Elem{} ): NIHIL{ nihil }, top{ 0 }, bottom{ 0 }, seq{}{}
+
+    Deque( const Deque& )              = delete;
+    Deque& operator = ( const Deque& ) = delete;
+                                                                                                                              /*
+    Approximate size (exact only when called by the owner while no steal in progress):
+                                                                                                                              */
+    unsigned size() const {
+      const int64_t b{ bottom.load( std::memory_order_relaxed ) };
+      const int64_t t{ top   .load( std::memory_order_relaxed ) };
+      return b > t ? unsigned( b - t ) : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+    Elem nihil() const { return NIHIL;       }
+
+    bool push( const Elem& e ){
+                                                                                                                              /*
+      Owner only; returns `false` if pushing will cause overrun:
+                                                                                                                              */
+      assert( e != NIHIL );
+      const int64_t b{ bottom.load( std::memory_order_relaxed ) };
+      const int64_t t{ top   .load( std::memory_order_acquire ) };
+      if( b - t >= int64_t( CAPACITY ) ) return false;
+      seq[ b & MASK ].store( e, std::memory_order_relaxed );
+      std::atomic_thread_fence( std::memory_order_release );
+      bottom.store( b + 1, std::memory_order_relaxed );
+      return true;
+    }
+
+    Elem pop(){
+                                                                                                                              /*
+      Owner only; removes and returns last pushed (youngest) element or NIHIL if the deque is empty:
+                                                                                                                              */
+      const int64_t b{ bottom.load( std::memory_order_relaxed ) - 1 };
+      bottom.store( b, std::memory_order_relaxed );
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      int64_t t{ top.load( std::memory_order_relaxed ) };
+      if( t > b ){ // Empty:
+        bottom.store( b + 1, std::memory_order_relaxed );
+        return NIHIL;
+      }
+      Elem e{ seq[ b & MASK ].load( std::memory_order_relaxed ) };
+      if( t == b ){
+                                                                                                                              /*
+        Last element; race against thieves:
+                                                                                                                              */
+        if( not top.compare_exchange_strong( /*mod*/ t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) ) e = NIHIL;
+        bottom.store( b + 1, std::memory_order_relaxed );
+      }
+      return e;
+    }
+
+    Elem steal(){
+                                                                                                                              /*
+      Any thread; removes and returns oldest element or NIHIL if the deque is empty or race lost:
+                                                                                                                              */
+      int64_t t{ top.load( std::memory_order_acquire ) };
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      const int64_t b{ bottom.load( std::memory_order_acquire ) };
+      if( t >= b ) return NIHIL;
+      const Elem e{ seq[ t & MASK ].load( std::memory_order_relaxed ) };
+      if( not top.compare_exchange_strong( /*mod*/ t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) ) return NIHIL;
+      return e;
+    }
+
+  };//Deque
+
+}//namespace CoreAGI
+
+#endif // DEQUE_H_INCLUDED
@@ -14,6 +14,21 @@ _______________________________________________________________________________
 
  2023.05.04 Initial version
 
+ 2026.10.18 Wait-list: a waiter (logical process) that failed to get access can be parked
+            on the Fluid and woken up by the next access release instead of retrying
+
+ 2026.10.18 Parked waiter can be withdrawn from the wait-list (`unpark`)
+
+ 2026.10.18 Wait-list extracted into the base class `WaitList` shared with `Mailbox`
+
+ 2026.10.18 Explicit `acquire`/`release` of access and `Fluid::read()`/`write()` claims used by
+            awaitable access of coroutine processes (see `coroutine.process.h`)
+
+ 2026.10.18 Denied access requests counted (`denials`) for telemetry (see `telemetry.h`)
+
+ 2026.10.18 Last Fluid accessed by the thread (`touched`) and the Staff member its frequent
+            users gathered on (`home`) kept for locality-aware placement (see `staff.h`)
+
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef FLUID_H_INCLUDED
@@ -23,10 +38,14 @@ ________________________________________________________________________________
 #include <cassert>
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
 
+#include <algorithm>
 #include <atomic>
 #include <concepts>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 #include "def.h"
 //#include "logic.h"
@@ -34,8 +53,89 @@ ________________________________________________________________________________
 #include "timer.h"
 
 namespace CoreAGI {
+                                                                                                                              /*
+  Something that can be parked on the wait-list of Fluid or Mailbox and woken up when the
+  resource became available (see `LogicalProcess`):
+                                                                                                                              */
+  struct Waiter {
+    virtual void wake() const = 0;
+  };
 
-  class FluidCore {
+                                                                                                                              /*
+  List of waiters parked until some resource (Fluid, Mailbox) became available:
+                                                                                                                              */
+  class WaitList {
+  public:
+
+    enum class Access{ READ, WRITE }; // :what waiter is waiting for
+
+  protected:
+
+    mutable std::mutex                   waitLock; // :protects `waiting`
+    mutable std::vector< const Waiter* > waiting;  // :parked waiters
+    mutable std::atomic< unsigned >      waiters;  // :size of `waiting`, checked without lock
+
+    void notify() const {
+                                                                                                                              /*
+      Called after resource became available (e.g. access released): wake up all parked
+      waiters (they retry and, if failed, park again). Waiters count read after the state
+      transition, so either releaser sees the registered waiter or the waiter sees the
+      released state (see `park`):
+                                                                                                                              */
+      if( waiters.load() == 0 ) return;
+      std::vector< const Waiter* > W;
+      {
+        std::lock_guard< std::mutex > lock( waitLock );
+        W.swap( waiting );
+        waiters.store( 0 );
+      }
+      for( const Waiter* w: W ) w->wake();
+    }
+
+  public:
+
+    WaitList(): waitLock{}, waiting{}, waiters{ 0 }{}
+
+    WaitList( const WaitList& )              = delete;
+    WaitList& operator = ( const WaitList& ) = delete;
+
+    virtual bool available( const Access& access ) const = 0; // :request has chance to succeed right now
+
+    void park( const Waiter* waiter, const Access& access ) const {
+                                                                                                                              /*
+      Add waiter to the wait-list; if access became available while registering, wake up
+      immediately, so wake-up can`t be lost:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( waitLock );
+        waiting.push_back( waiter );
+        waiters++;
+      }
+      if( available( access ) ) notify();
+    }
+
+    bool unpark( const Waiter* waiter ) const {
+                                                                                                                              /*
+      Withdraw waiter from the wait-list; `false` if it is not there (e.g. being woken up):
+                                                                                                                              */
+      std::lock_guard< std::mutex > lock( waitLock );
+      const auto i = std::find( waiting.begin(), waiting.end(), waiter );
+      if( i == waiting.end() ) return false;
+      waiting.erase( i );
+      waiters.store( waiting.size() );
+      return true;
+    }
+
+    unsigned parked() const { return waiters.load(); }
+
+    virtual ~WaitList(){}
+
+  };//WaitList
+
+
+  class StaffCore; // :keeps placement state in Fluids (see `staff.h`)
+
+  class FluidCore: public WaitList {
   public:
                                                                                                                               /*
     Class implements state machines that provide:
@@ -199,14 +299,30 @@ namespace CoreAGI {
 
     static const TransitionGraph transitionGraph;
 
+                                                                                                                              /*
+    Access modes of the wait-list mapped onto goals used by `check()` and `alter()`:
+                                                                                                                              */
+    static constexpr Goal acquiring( [[maybe_unused]] const Access& access ){
+      return Goal::Mi; // :both `check()` and `alter()` request `Mi`
+    }
+
   protected:
 
-    mutable std::atomic< Packed > packed; // :finite automaton state
-    const unsigned                ARLIM;  // :active readers limit
+    mutable std::atomic< Packed >        packed;   // :finite automaton state
+    const unsigned                       ARLIM;    // :active readers limit
+    mutable std::atomic< uint64_t >      denied;   // :denied access requests; touched by failed requests only
+
+  private:
+
+    friend class StaffCore;
+
+    mutable std::atomic< int >           home;     // :Staff member the users gathered on, -1 if none (see `StaffCore::colocate`)
 
   public:
 
-    FluidCore( const unsigned n ): packed{ packup( State::I, 0 ) }, ARLIM{ n }{} // :initial state is `I` ~ idling
+    inline static thread_local const FluidCore* touched{ nullptr }; // :last Fluid accessed by the thread
+
+    FluidCore( const unsigned n ): WaitList{}, packed{ packup( State::I, 0 ) }, ARLIM{ n }, denied{ 0 }, home{ -1 }{} // :initial state is `I` ~ idling
 
     FluidCore(       FluidCore&& ) = default;
     FluidCore( const FluidCore&  ) = delete;
@@ -284,11 +400,49 @@ namespace CoreAGI {
 
     Unpacked state() const { return Unpacked{ packed.load() }; }
 
+    uint64_t denials() const { return denied.load( std::memory_order_relaxed ); }
+
+    bool available( const Access& access ) const override {
+                                                                                                                              /*
+      Access can be requested with chance to succeed right now:
+                                                                                                                              */
+      const Unpacked unpacked{ packed.load() };
+      return transitionGraph( acquiring( access ), unpacked.state ).state != State::O;
+    }
+
+    bool acquire( const Access& access ) const {
+      if( run( acquiring( access ) ) ){ touched = this; return true; }
+      denied.fetch_add( 1, std::memory_order_relaxed );
+      return false;
+    }
+
+    void release() const {
+                                                                                                                              /*
+      Return access obtained by `acquire`:
+                                                                                                                              */
+      if( run( Goal::Mt ) ){ notify(); return; }
+      constexpr Duration RETURN_ACCESS_TIMEOUT{ Duration::Value{ 10.0 }[ MILLISEC ] };
+      for( Timer timer; timer < RETURN_ACCESS_TIMEOUT; ){
+        if( run( Goal::Mt ) ){ notify(); return; }
+        std::this_thread::yield();
+      }
+      assert( false ); // :deadlock
+    }
+
   };//FluidCore
 
 
   const FluidCore::TransitionGraph FluidCore::transitionGraph{};
 
+                                                                                                                              /*
+  Request of access to the shared object; acquired by `co_await` in coroutine process:
+                                                                                                                              */
+  template< typename Data > struct Claim {
+    const FluidCore*  fluid;
+    Data*             data;
+    FluidCore::Access access;
+  };
+
 
   template< std::default_initializable Data > class Fluid: public FluidCore {
 
@@ -306,11 +460,15 @@ namespace CoreAGI {
 
    ~Fluid(){ }
 
+    Claim< const Data > read () const { return { this, &data, Access::READ  }; }
+    Claim<       Data > write()       { return { this, &data, Access::WRITE }; }
+
     bool alter( std::function< void( Data& ) > func ){
                                                                                                                               /*
       Obtain write permission:
                                                                                                                               */
-      if( not run( Goal::Mi ) ) return false;
+      if( not run( Goal::Mi ) ){ denied.fetch_add( 1, std::memory_order_relaxed ); return false; }
+      touched = this;
                                                                                                                               /*
       Call modification function:
                                                                                                                               */
@@ -318,11 +476,11 @@ namespace CoreAGI {
                                                                                                                               /*
       Return write permission:
                                                                                                                               */
-      if( run( Goal::Mt ) ) return true;
+      if( run( Goal::Mt ) ){ notify(); return true; }
 
       constexpr Duration RETURN_ACCESS_TIMEOUT{ Duration::Value{ 10.0 }[ MILLISEC ] };
       for( Timer timer; timer < RETURN_ACCESS_TIMEOUT; ){
-        if( run( Goal::Mt ) ) return true;
+        if( run( Goal::Mt ) ){ notify(); return true; }
         std::this_thread::yield();
       }
       assert( false ); // :deadlock
@@ -333,7 +491,8 @@ namespace CoreAGI {
                                                                                                                               /*
       Obtain read permission:
                                                                                                                               */
-      if( not run( Goal::Mi ) ) return false;
+      if( not run( Goal::Mi ) ){ denied.fetch_add( 1, std::memory_order_relaxed ); return false; }
+      touched = this;
                                                                                                                               /*
       Call access function:
                                                                                                                               */
@@ -341,11 +500,11 @@ namespace CoreAGI {
                                                                                                                               /*
       Return read permission:
                                                                                                                               */
-      if( run( Goal::Mt ) ) return true;
+      if( run( Goal::Mt ) ){ notify(); return true; }
 
       constexpr Duration RETURN_ACCESS_TIMEOUT{ Duration::Value{ 10.0 }[ MILLISEC ] };
       for( Timer timer; timer < RETURN_ACCESS_TIMEOUT; ){
-        if( run( Goal::Mt ) ) return true;
+        if( run( Goal::Mt ) ){ notify(); return true; }
         // std::this_thread::yield();
       }
       assert( false ); // :deadlock
@@ -0,0 +1,209 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Open-loop tail-latency harness for Fluid: issuer threads start `check` (read) and
+ `alter` (write) operations on the shared object at fixed offered rate regardless of
+ completions; denied access is retried until success. Latency of an operation counted
+ from its intended issue time (not from the actual start), so stalls of the issuer are
+ charged to all operations they delayed (coordinated omission correction); service time
+ (actual start to release) recorded separately. Quantiles from log-linear histograms
+ (see `histogram.h`) reported for every offered load.
+
+ Usage: fluid.latency [ key=value ... ]
+
+   rates=10000,100000 offered loads, operations per second (all issuers together)
+   threads=4          issuer threads
+   reads=0.9          fraction of `check` operations
+   cs=100             words touched inside the access
+   duration=1000      measured interval per load, millisec
+   warmup=200         interval before measurement, millisec
+   format=text        `text` (log) or `csv`
+   output=FILE        file for `csv` (default: fluid.latency.csv)
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger.global.h"
+#include "chronos.h"
+#include "fluid.h"
+#include "histogram.h"
+
+namespace CoreAGI {
+
+  constexpr unsigned CAPACITY{ 4096 }; // :max words touched inside the access
+
+  struct Cells {
+    uint64_t word[ CAPACITY ];
+  };
+
+  struct Recorder {
+    Histogram<> response[2]; // :from intended issue time to release; [0] check, [1] alter
+    Histogram<> service [2]; // :from actual start to release
+    uint64_t    issued { 0 };
+    uint64_t    denied { 0 };
+    uint64_t    behind { 0 }; // :operations started after their intended time
+    double      finish { 0 }; // :completion of the last measured operation
+  };
+
+  struct Load {
+    double   achieved;  // :completed operations per second
+    double   denial;    // :denied attempts per operation
+    double   behind;    // :fraction of operations issued late
+    uint64_t quantile[2][2][4]; // :[response/service][check/alter][p50,p99,p99.9,max], nanosec
+  };
+
+  Load measure( double rate, unsigned threads, double reads, unsigned cs, unsigned duration, unsigned warmup ){
+    auto fluid = std::make_unique< Fluid< Cells > >();
+    std::vector< std::unique_ptr< Recorder > > R;
+    for( unsigned t = 0; t < threads; t++ ) R.emplace_back( std::make_unique< Recorder >() );
+    const Chronos clock;
+    const double  interval{ 1.0e9*threads/rate };     // :nanosec between operations of one issuer
+    const double  begin   { clock.nanosec() + 1.0e6 }; // :issuers started by then
+    const double  measured{ begin + 1.0e6*warmup };
+    const double  end     { measured + 1.0e6*duration };
+    std::vector< std::thread > T;
+    for( unsigned t = 0; t < threads; t++ ){
+      T.emplace_back( [&, t]{
+        Recorder& my = *R[t];
+        uint64_t  x{ 0x9E3779B97F4A7C15ull*( t + 1 ) };
+        uint64_t  sum{ 0 };
+        for( uint64_t k = 0;; k++ ){
+                                                                                                                              /*
+          Intended issue time; issuers shifted so they don`t start in the same instant:
+                                                                                                                              */
+          const double intended{ begin + interval*( k + double( t )/threads ) };
+          if( intended >= end ) break;
+          double now{ clock.nanosec() };
+          if( intended - now > 100.0e3 ) std::this_thread::sleep_for( std::chrono::nanoseconds( int64_t( intended - now - 50.0e3 ) ) );
+          while( ( now = clock.nanosec() ) < intended ) std::this_thread::yield();
+          const bool counted{ intended >= measured };
+          x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+          const bool reading{ double( x >> 11 )*0x1.0p-53 < reads };
+          uint64_t denials{ 0 };
+          if( reading ){
+            while( not fluid->check( [&]( const Cells& C ){ for( unsigned i = 0; i < cs; i++ ) sum += C.word[i]; } ) ){ denials++; std::this_thread::yield(); }
+          } else {
+            while( not fluid->alter( [&]( Cells& C ){ for( unsigned i = 0; i < cs; i++ ) C.word[i]++; } ) ){ denials++; std::this_thread::yield(); }
+          }
+          const double done{ clock.nanosec() };
+          if( not counted ) continue;
+          my.response[ reading ? 0 : 1 ].record( done - intended );
+          my.service [ reading ? 0 : 1 ].record( done - now      );
+          my.issued++;
+          my.denied += denials;
+          if( now - intended > interval ) my.behind++;
+          my.finish = done;
+        }
+        if( sum == 42 ) printf( " " ); // :keep reads alive
+      });
+    }
+    for( auto& t: T ) t.join();
+
+    Load L{};
+    Histogram<> H[2][2];
+    uint64_t issued{ 0 }, denied{ 0 }, behind{ 0 };
+    double   finish{ end };
+    for( auto& r: R ){
+      finish = std::max( finish, r->finish );
+      for( unsigned j = 0; j < 2; j++ ){ H[0][j].merge( r->response[j] ); H[1][j].merge( r->service[j] ); }
+      issued += r->issued; denied += r->denied; behind += r->behind;
+    }
+    L.achieved = issued/( 1.0e-9*( finish - measured ) ); // :backlog drained after the end slows it down
+    L.denial   = issued ? double( denied )/issued : 0.0;
+    L.behind   = issued ? double( behind )/issued : 0.0;
+    for( unsigned i = 0; i < 2; i++ ) for( unsigned j = 0; j < 2; j++ ){
+      L.quantile[i][j][0] = H[i][j].quantile( 0.5   );
+      L.quantile[i][j][1] = H[i][j].quantile( 0.99  );
+      L.quantile[i][j][2] = H[i][j].quantile( 0.999 );
+      L.quantile[i][j][3] = H[i][j].max();
+    }
+    return L;
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  std::vector< double > RATES{ 10000, 100000 };
+  unsigned    THREADS{ 4 }, CS{ 100 }, DURATION{ 1000 }, WARMUP{ 200 };
+  double      READS{ 0.9 };
+  std::string FORMAT{ "text" }, OUTPUT{ "fluid.latency.csv" };
+  for( int i = 1; i < argc; i++ ){
+    const char* eq = strchr( argv[i], '=' );
+    const std::string key( argv[i], eq ? eq - argv[i] : strlen( argv[i] ) );
+    const char* value{ eq ? eq + 1 : "" };
+    if( key == "rates" ){
+      RATES.clear();
+      for( const char* s = value; s and *s; ){ RATES.push_back( atof( s ) ); s = strchr( s, ',' ); if( s ) s++; }
+    }
+    else if( key == "threads"  ) THREADS  = std::max( 1, atoi( value ) );
+    else if( key == "reads"    ) READS    = atof( value );
+    else if( key == "cs"       ) CS       = std::clamp( unsigned( atoi( value ) ), 1u, CAPACITY );
+    else if( key == "duration" ) DURATION = unsigned( atoi( value ) );
+    else if( key == "warmup"   ) WARMUP   = unsigned( atoi( value ) );
+    else if( key == "format"   ) FORMAT   = value;
+    else if( key == "output"   ) OUTPUT   = value;
+    else {
+      fprintf( stderr, "Usage: fluid.latency [ rates=10000,100000 threads= reads= cs= duration= warmup= format=text|csv output= ]\n" );
+      return 1;
+    }
+  }
+
+  auto log = logger.log( "latency" );
+  FILE* out{ nullptr };
+  if( FORMAT == "csv" ){
+    out = fopen( OUTPUT.c_str(), "w" );
+    if( not out ){ log.vital( kit( "can`t open %s", OUTPUT.c_str() ) ); return 1; }
+    fprintf( out, "offered,achieved,threads,reads,cs,denial,behind,"
+                  "check_p50_us,check_p99_us,check_p999_us,check_max_us,alter_p50_us,alter_p99_us,alter_p999_us,alter_max_us,"
+                  "check_service_p999_us,check_service_max_us,alter_service_p999_us,alter_service_max_us\n" );
+  }
+  log.vital( kit( "%u issuers, reads %.3f, cs %u words, %u+%u millisec per load; latency from intended issue time, microsec",
+                  THREADS, READS, CS, WARMUP, DURATION ) );
+
+  for( double rate: RATES ){
+    const Load L{ measure( rate, THREADS, READS, CS, DURATION, WARMUP ) };
+    auto us = []( uint64_t ns ){ return 1.0e-3*ns; };
+    log.vital( kit( "  offered %10.0f  achieved %10.0f ops/sec  denied %6.3f per op  late %6.2f %%",
+                    rate, L.achieved, L.denial, 100.0*L.behind ) );
+    const char* NAME[2]{ "check", "alter" };
+    for( unsigned j = 0; j < 2; j++ ){
+      log.vital( kit( "    %s  p50 %9.1f  p99 %9.1f  p99.9 %9.1f  max %9.1f   service p99.9 %9.1f  max %9.1f",
+                      NAME[j], us( L.quantile[0][j][0] ), us( L.quantile[0][j][1] ), us( L.quantile[0][j][2] ), us( L.quantile[0][j][3] ),
+                      us( L.quantile[1][j][2] ), us( L.quantile[1][j][3] ) ) );
+    }
+    if( out ){
+      fprintf( out, "%.0f,%.0f,%u,%.4f,%u,%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+               rate, L.achieved, THREADS, READS, CS, L.denial, L.behind,
+               us( L.quantile[0][0][0] ), us( L.quantile[0][0][1] ), us( L.quantile[0][0][2] ), us( L.quantile[0][0][3] ),
+               us( L.quantile[0][1][0] ), us( L.quantile[0][1][1] ), us( L.quantile[0][1][2] ), us( L.quantile[0][1][3] ),
+               us( L.quantile[1][0][2] ), us( L.quantile[1][0][3] ), us( L.quantile[1][1][2] ), us( L.quantile[1][1][3] ) );
+      fflush( out );
+    }
+  }
+  if( out ) fclose( out );
+  log.flush();
+
+  CoreAGI::pause{ 100 }[ MILLISEC ];
+
+  return 0;
+}
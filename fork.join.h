@@ -0,0 +1,342 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Fork-join tasks executed by Staff members: heavy step of a logical process splits its
+ work into tasks that idle members execute instead of idle picks of processes.
+
+   LogicalProcess scan( "scan", [&]( const Log& log )->bool {
+     double a, b;
+     parallelInvoke( [&]{ a = sum( 0, L/2 ); }, [&]{ b = sum( L/2, L ); } );
+     ...
+   });
+
+   TaskGroup group;                        // :tasks of the current member`s Staff
+   for( auto i: RANGE( 8 ) ) group.spawn( [&, i]{ part( i ); } );
+   group.sync();                           // :caller executes tasks while waiting
+
+ Every member owns work-stealing deque of tasks (see `deque.h`): task spawned by a member
+ pushed into own deque, members and waiting callers take own tasks in LIFO order (depth
+ first, warm cache) and steal the oldest tasks of others; tasks spawned by other threads
+ go through the shared queue. Members run tasks before taking the next process.
+
+ HELP_FIRST policy (default) queues every spawned task and the caller goes on spawning;
+ WORK_FIRST executes spawned task at once when the caller`s deque holds enough tasks for
+ all members already (continuation is not stolen: C++ has no portable way to do that),
+ which bounds the number of queued tasks for recursive splitting.
+
+ `sync` returns when all tasks of the group are done; caller takes part in execution
+ (of any tasks, not only of its group), so waiting never blocks a member. Outside Staff
+ (or when Staff has no members running) tasks are executed by the caller itself.
+ Exception thrown by a task doesn`t escape the thread that executes it: the first one
+ of the group is rethrown by `sync` (destructor of the group only waits).
+
+ Loops over ranges split recursively into halves down to `grain` indices (default: range
+ divided into 4 chunks per member), halves executed as tasks:
+
+   parallelFor( RANGE( L ), [&]( unsigned i ){ for( auto j: RANGE( L ) ) R[i][j] *= k; } );
+   const double s = parallelReduce( RANGE( L ), 0.0,
+                                    [&]( double s, unsigned i ){ return s + R[i][i]; },
+                                    []( double a, double b ){ return a + b; } );
+   parallelFor( RANGE2D( L, L, 32, 32 ), [&]( unsigned i, unsigned j ){ T[j][i] = R[i][j]; } );
+
+ `parallelReduce` combines partial results in index order (deterministic for associative
+ `combine`); tiles of RANGE2D are tasks, cells of a tile are visited by one thread.
+
+ 2026.10.18  Initial version
+
+ 2026.10.18  parallelFor, parallelReduce over RANGE and RANGE2D
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef FORK_JOIN_H_INCLUDED
+#define FORK_JOIN_H_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "config.h"
+#include "deque.h"
+#include "range.h"
+
+namespace CoreAGI {
+
+  class TaskPool {
+  public:
+
+    struct Join {                       // :state of the group shared by its tasks
+      std::atomic< unsigned > pending;  // :tasks not done yet
+      std::atomic< bool >     failed;   // :some task has thrown
+      std::exception_ptr      error;    // :the first exception, written by the task that set `failed`
+    };
+
+    struct Task {
+      std::function< void() > work;
+      Join*                   join;
+    };
+
+  private:
+
+    using Queue = Deque< Task*, Config::staff::TASK_CAPACITY >;
+
+    const unsigned                SIZE;      // :number of member queues
+    std::unique_ptr< Queue[] >    queue;
+    std::mutex                    injection; // :protects `inbox`
+    std::deque< Task* >           inbox;     // :tasks spawned by non-members
+    std::atomic< unsigned >       injected;  // :size of `inbox`, checked without lock
+    std::atomic< unsigned >       queued;    // :tasks spawned but not taken yet
+    std::atomic< unsigned >       members;   // :members running
+    std::function< void() >       bell;      // :wakes up dozing member
+
+    inline static thread_local TaskPool* owner { nullptr }; // :pool of the member run by current thread
+    inline static thread_local unsigned  worker{ 0       }; // :index of the member
+
+    Task* take(){
+                                                                                                                              /*
+      Own tasks (newest first), then shared queue, then oldest task of other members:
+                                                                                                                              */
+      Task* t{ nullptr };
+      const bool member{ owner == this };
+      if( member and ( t = queue[ worker ].pop() ) ) return t;
+      if( injected.load( std::memory_order_relaxed ) ){
+        std::lock_guard< std::mutex > lock( injection );
+        if( not inbox.empty() ){ t = inbox.front(); inbox.pop_front(); injected.store( inbox.size() ); return t; }
+      }
+      const unsigned start{ member ? worker + 1 : 0 };
+      for( unsigned k = 0; k < SIZE; k++ ){
+        const unsigned i{ ( start + k ) % SIZE };
+        if( member and i == worker ) continue;
+        if( ( t = queue[i].steal() ) ) return t;
+      }
+      return nullptr;
+    }
+
+    static void execute( Task* t ){
+                                                                                                                              /*
+      Task deleted and counted as done on every path, so `sync` never waits forever;
+      `error` published by the release decrement:
+                                                                                                                              */
+      Join* join{ t->join };
+      try {
+        t->work();
+      } catch( ... ){
+        if( not join->failed.exchange( true ) ) join->error = std::current_exception();
+      }
+      delete t;
+      join->pending.fetch_sub( 1, std::memory_order_release );
+    }
+
+  public:
+
+    TaskPool( unsigned size, std::function< void() > wake = {} ):
+      SIZE     { size                                },
+      queue    { std::make_unique< Queue[] >( size ) },
+      injection{                                     },
+      inbox    {                                     },
+      injected { 0                                   },
+      queued   { 0                                   },
+      members  { 0                                   },
+      bell     { std::move( wake )                   }
+    {}
+
+    TaskPool( const TaskPool& )              = delete;
+    TaskPool& operator = ( const TaskPool& ) = delete;
+
+    static TaskPool* current(){ return owner; } // :pool of the member run by current thread, if any
+
+    void enter( unsigned i ){ owner = this; worker = i; members++; } // :called by member thread at start
+    void leave(){ owner = nullptr; members--; }                       // :and at finish
+
+    unsigned pending() const { return queued.load( std::memory_order_relaxed ); }
+
+    unsigned depth() const {
+                                                                                                                              /*
+      Tasks in the deque of the current member (0 for non-member):
+                                                                                                                              */
+      return owner == this ? queue[ worker ].size() : 0;
+    }
+
+    unsigned size() const { return SIZE; }
+
+    void spawn( Task* t ){
+                                                                                                                              /*
+      Nobody can execute task if no member runs: executed by the caller:
+                                                                                                                              */
+      if( members.load( std::memory_order_relaxed ) == 0 and owner != this ){ execute( t ); return; }
+      queued.fetch_add( 1, std::memory_order_relaxed );
+      if( owner == this ){
+        if( not queue[ worker ].push( t ) ){ queued.fetch_sub( 1, std::memory_order_relaxed ); execute( t ); return; } // :deque full
+      } else {
+        std::lock_guard< std::mutex > lock( injection );
+        inbox.push_back( t );
+        injected.store( inbox.size() );
+      }
+      if( bell ) bell();
+    }
+
+    bool help(){
+                                                                                                                              /*
+      Execute one task if any; returns `false` if nothing found:
+                                                                                                                              */
+      if( queued.load( std::memory_order_relaxed ) == 0 ) return false;
+      Task* t{ take() };
+      if( not t ) return false;
+      queued.fetch_sub( 1, std::memory_order_relaxed );
+      execute( t );
+      return true;
+    }
+
+    void drain(){
+                                                                                                                              /*
+      Execute tasks left (called when no member runs anymore):
+                                                                                                                              */
+      while( help() );
+    }
+
+  };//TaskPool
+
+
+  class TaskGroup {
+  public:
+
+    enum class Policy{ HELP_FIRST, WORK_FIRST };
+
+  private:
+
+    TaskPool*               pool;
+    const Policy            POLICY;
+    TaskPool::Join          join;
+
+    void wait(){
+                                                                                                                              /*
+      Wait for all tasks of the group executing tasks meanwhile:
+                                                                                                                              */
+      while( join.pending.load( std::memory_order_acquire ) > 0 ){
+        if( not pool->help() ) std::this_thread::yield(); // :remaining tasks are being executed by others
+      }
+    }
+
+  public:
+
+    explicit TaskGroup( TaskPool* P = TaskPool::current(), Policy policy = Policy::HELP_FIRST ):
+      pool{ P }, POLICY{ policy }, join{ 0, false, nullptr }{}
+
+    explicit TaskGroup( Policy policy ): TaskGroup( TaskPool::current(), policy ){}
+
+    TaskGroup( const TaskGroup& )              = delete;
+    TaskGroup& operator = ( const TaskGroup& ) = delete;
+
+    template< typename F > void spawn( F&& f ){
+      if( not pool or ( POLICY == Policy::WORK_FIRST and pool->depth() >= 2*pool->size() ) ){ f(); return; }
+      join.pending.fetch_add( 1, std::memory_order_relaxed );
+      pool->spawn( new TaskPool::Task{ std::function< void() >( std::forward< F >( f ) ), &join } );
+    }
+
+    void sync(){
+                                                                                                                              /*
+      Wait for all tasks of the group, then rethrow the first exception thrown by them
+      (the group can be reused after that):
+                                                                                                                              */
+      wait();
+      if( not join.failed.load( std::memory_order_relaxed ) ) return;
+      std::exception_ptr error{ std::move( join.error ) };
+      join.error = nullptr;
+      join.failed.store( false, std::memory_order_relaxed );
+      std::rethrow_exception( error );
+    }
+
+   ~TaskGroup(){ wait(); } // :exception not taken by `sync` is lost
+
+  };//TaskGroup
+
+
+  template< typename F, typename... G > void parallelInvoke( F&& f, G&&... g ){
+                                                                                                                              /*
+    Execute functions in parallel: all but the first spawned, the first executed by the
+    caller, then waits for the rest:
+                                                                                                                              */
+    TaskGroup group;
+    ( group.spawn( std::forward< G >( g ) ), ... );
+    f();
+    group.sync();
+  }
+
+  namespace parallel {
+
+    template< typename Elem > Elem grain( Elem n, Elem grain ){
+                                                                                                                              /*
+      Default grain gives 4 chunks per member (if any) to balance unequal chunks:
+                                                                                                                              */
+      if( grain > 0 ) return grain;
+      const TaskPool* pool{ TaskPool::current() };
+      const Elem      chunks( 4*( pool ? pool->size() : 1 ) );
+      return std::max( Elem( 1 ), Elem( n/chunks ) );
+    }
+
+    template< typename Elem, typename F > void split( Elem from, Elem upto, Elem grain, const F& body ){
+      TaskGroup group;
+      while( upto - from > grain ){ // :right halves spawned, left one processed further
+        const Elem middle( from + ( upto - from )/2 );
+        group.spawn( [=, &body]{ split( middle, upto, grain, body ); } );
+        upto = middle;
+      }
+      for( Elem i = from; i < upto; i++ ) body( i );
+      group.sync();
+    }
+
+    template< typename T, typename Elem, typename F, typename C >
+    T reduce( Elem from, Elem upto, Elem grain, const T& identity, const F& fold, const C& combine ){
+      if( upto - from <= grain ){
+        T result{ identity };
+        for( Elem i = from; i < upto; i++ ) result = fold( std::move( result ), i );
+        return result;
+      }
+      const Elem middle( from + ( upto - from )/2 );
+      T          right { identity };
+      TaskGroup  group;
+      group.spawn( [&]{ right = reduce( middle, upto, grain, identity, fold, combine ); } );
+      T left{ reduce( from, middle, grain, identity, fold, combine ) };
+      group.sync();
+      return combine( std::move( left ), std::move( right ) );
+    }
+
+  }//namespace parallel
+
+  template< typename Elem, typename F > void parallelFor( const RANGE< Elem >& range, F&& body, std::type_identity_t< Elem > grain = 0 ){
+                                                                                                                              /*
+    `body( i )` for every index of the range; returns when all done:
+                                                                                                                              */
+    if( range.size() == 0 ) return;
+    parallel::split( range.lower(), range.upper(), parallel::grain( range.size(), grain ), body );
+  }
+
+  template< typename Elem, typename F > void parallelFor( const RANGE2D< Elem >& range, F&& body, std::type_identity_t< Elem > grain = 1 ){
+                                                                                                                              /*
+    `body( row, col )` for every cell; `grain` is number of tiles per task:
+                                                                                                                              */
+    parallelFor( RANGE< Elem >( range.tiles() ), [&]( Elem k ){ for( auto [ i, j ]: range.tile( k ) ) body( i, j ); }, grain );
+  }
+
+  template< typename T, typename Elem, typename F, typename C >
+  T parallelReduce( const RANGE< Elem >& range, const T& identity, F&& fold, C&& combine, std::type_identity_t< Elem > grain = 0 ){
+                                                                                                                              /*
+    `combine( ..combine( fold( ..fold( identity, i0 ).., i1 ), fold( ..fold( identity, i2 ).., i3 ) ).. )`,
+    where `fold( T, i )` accumulates index `i` and chunks are [ i0, i1 ], [ i2, i3 ] and so on:
+                                                                                                                              */
+    if( range.size() == 0 ) return identity;
+    return parallel::reduce( range.lower(), range.upper(), parallel::grain( range.size(), grain ), identity, fold, combine );
+  }
+
+}//namespace CoreAGI
+
+#endif // FORK_JOIN_H_INCLUDED
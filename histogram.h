@@ -0,0 +1,117 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Log-bucketed (HDR-style) histogram of non-negative integer values (nanoseconds).
+
+ Each power of 2 range divided into SUB linear sub-buckets, so relative error of
+ any reported quantile does not exceed 1/SUB; values up to 2^( EXP + log2( SUB ) )
+ are distinguished, larger ones fall into the last bucket (exact max kept apart).
+
+ Recording is lock-free and uses plain load/store instead of read-modify-write:
+ the histogram expects single writer at a time (e.g. the thread that occupies a
+ logical process); concurrent readers are allowed. For many writers use one
+ histogram per thread and `merge` them.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef HISTOGRAM_H_INCLUDED
+#define HISTOGRAM_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+namespace CoreAGI {
+
+  template< unsigned SUB = 8, unsigned EXP = 40 > class Histogram {
+
+    static_assert( std::has_single_bit( SUB ) );
+
+    static constexpr unsigned K   { unsigned( std::bit_width( SUB ) - 1 ) }; // :log2( SUB )
+    static constexpr unsigned SIZE{ SUB*( EXP + 2 )                       }; // :number of buckets
+
+    std::atomic< uint64_t > bucket[ SIZE ];
+    std::atomic< uint64_t > total;
+    std::atomic< uint64_t > largest;
+
+    static void bump( std::atomic< uint64_t >& n, uint64_t d = 1 ){
+      n.store( n.load( std::memory_order_relaxed ) + d, std::memory_order_relaxed );
+    }
+
+  public:
+
+    static constexpr unsigned index( uint64_t v ){
+                                                                                                                              /*
+      Values below 2*SUB have own buckets; above, bucket width doubles every SUB buckets:
+                                                                                                                              */
+      const unsigned w{ unsigned( std::bit_width( v ) ) };
+      const unsigned e{ w > K + 1 ? w - K - 1 : 0 };
+      return std::min( unsigned( SUB*e + ( v >> e ) ), SIZE - 1 );
+    }
+
+    static constexpr uint64_t upper( unsigned i ){
+                                                                                                                              /*
+      Highest value that falls into bucket `i`:
+                                                                                                                              */
+      const unsigned e{ i < 2*SUB ? 0 : i/SUB - 1 };
+      return ( ( uint64_t( i - SUB*e ) + 1 ) << e ) - 1;
+    }
+
+    Histogram(): bucket{}, total{ 0 }, largest{ 0 }{}
+
+    Histogram( const Histogram& )              = delete;
+    Histogram& operator = ( const Histogram& ) = delete;
+
+    void record( uint64_t v ){
+      bump( bucket[ index( v ) ] );
+      bump( total );
+      if( v > largest.load( std::memory_order_relaxed ) ) largest.store( v, std::memory_order_relaxed );
+    }
+
+    void record( double v ){ record( uint64_t( v > 0 ? v : 0 ) ); }
+
+    void merge( const Histogram& H ){
+      for( unsigned i = 0; i < SIZE; i++ ) bump( bucket[i], H.bucket[i].load( std::memory_order_relaxed ) );
+      bump( total, H.total.load( std::memory_order_relaxed ) );
+      largest.store( std::max( largest.load(), H.largest.load() ) );
+    }
+
+    void clear(){
+      for( auto& b: bucket ) b.store( 0, std::memory_order_relaxed );
+      total  .store( 0 );
+      largest.store( 0 );
+    }
+
+    uint64_t count() const { return total  .load( std::memory_order_relaxed ); }
+    uint64_t max  () const { return largest.load( std::memory_order_relaxed ); }
+
+    uint64_t quantile( double q ) const {
+                                                                                                                              /*
+      Upper bound of the bucket that contains q-quantile, but not greater than max:
+                                                                                                                              */
+      uint64_t N{ 0 };
+      for( const auto& b: bucket ) N += b.load( std::memory_order_relaxed );
+      if( N == 0 ) return 0;
+      const uint64_t rank{ std::max( uint64_t( 1 ), uint64_t( std::ceil( q*N ) ) ) };
+      uint64_t n{ 0 };
+      for( unsigned i = 0; i < SIZE; i++ ){
+        n += bucket[i].load( std::memory_order_relaxed );
+        if( n >= rank ) return std::min( upper( i ), max() );
+      }
+      return max();
+    }
+
+  };//Histogram
+
+}//namespace CoreAGI
+
+#endif // HISTOGRAM_H_INCLUDED
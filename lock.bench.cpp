@@ -0,0 +1,274 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Comparative benchmark of synchronization primitives on identical workloads: threads
+ repeatedly read (sum) or write (increment) the shared array of `cs` words through
+
+   fluid    Fluid::check / Fluid::alter (denied access retried immediately)
+   shared   std::shared_mutex
+   mutex    std::mutex
+   ticket   ticket spinlock
+   seqlock  optimistic readers validated by sequence number, writers serialized
+
+ for every combination of thread count, critical section length and read ratio.
+ Reported: throughput of successful operations, fairness (Jain index and max/min
+ spread of per-thread counts), denial rate (Fluid denials, seqlock read retries) and
+ thread CPU time per successful operation.
+
+ Usage: lock.bench [ key=value ... ]
+
+   threads=1,2,4      thread counts (default: powers of 2 up to hardware threads)
+   cs=10,100,1000     critical section lengths, words
+   reads=0.5,0.9,0.99 read ratios
+   duration=200       millisec per point
+   format=text        `text` (log) or `csv`
+   output=FILE        file for `csv` (default: lock.bench.csv)
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger.global.h"
+#include "fluid.h"
+#include "timer.h"
+
+namespace CoreAGI {
+
+  constexpr unsigned CAPACITY{ 4096 }; // :max critical section length, words
+
+  struct Cells {
+    std::atomic< uint64_t > word[ CAPACITY ]; // :relaxed atomics so optimistic readers are well defined
+  };
+
+  inline void relax(){
+#if defined( __x86_64__ ) || defined( __i386__ )
+    __builtin_ia32_pause();
+#endif
+  }
+                                                                                                                              /*
+  Primitives with common interface; `read`/`write` return `false` if access denied:
+                                                                                                                              */
+  class FluidLock {
+    Fluid< Cells > fluid;
+  public:
+    static constexpr const char* NAME{ "fluid" };
+    template< typename F > bool read ( F&& f ){ return fluid.check( [&]( const Cells& C ){ f( C ); } ); }
+    template< typename F > bool write( F&& f ){ return fluid.alter( [&](       Cells& C ){ f( C ); } ); }
+  };
+
+  class SharedMutex {
+    std::shared_mutex lock;
+    Cells             cells;
+  public:
+    static constexpr const char* NAME{ "shared" };
+    template< typename F > bool read ( F&& f ){ std::shared_lock< std::shared_mutex > guard( lock ); f( cells ); return true; }
+    template< typename F > bool write( F&& f ){ std::unique_lock< std::shared_mutex > guard( lock ); f( cells ); return true; }
+  };
+
+  class Mutex {
+    std::mutex lock;
+    Cells      cells;
+  public:
+    static constexpr const char* NAME{ "mutex" };
+    template< typename F > bool read ( F&& f ){ std::lock_guard< std::mutex > guard( lock ); f( cells ); return true; }
+    template< typename F > bool write( F&& f ){ std::lock_guard< std::mutex > guard( lock ); f( cells ); return true; }
+  };
+
+  class TicketLock {
+    alignas( 64 ) std::atomic< unsigned > next   { 0 };
+    alignas( 64 ) std::atomic< unsigned > serving{ 0 };
+    Cells cells;
+    void lock(){
+      const unsigned ticket{ next.fetch_add( 1, std::memory_order_relaxed ) };
+      for( unsigned spin = 0; serving.load( std::memory_order_acquire ) != ticket; spin++ ){
+        if( spin < 64 ) relax(); else std::this_thread::yield(); // :holder may be preempted
+      }
+    }
+    void unlock(){ serving.store( serving.load( std::memory_order_relaxed ) + 1, std::memory_order_release ); }
+  public:
+    static constexpr const char* NAME{ "ticket" };
+    template< typename F > bool read ( F&& f ){ lock(); f( cells ); unlock(); return true; }
+    template< typename F > bool write( F&& f ){ lock(); f( cells ); unlock(); return true; }
+  };
+
+  class SeqLock {
+    alignas( 64 ) std::atomic< uint64_t > sequence{ 0 }; // :odd while writer inside
+    Cells cells;
+  public:
+    static constexpr const char* NAME{ "seqlock" };
+    template< typename F > bool read( F&& f ){
+      const uint64_t s{ sequence.load( std::memory_order_acquire ) };
+      if( s & 1 ) return false;
+      f( cells );
+      std::atomic_thread_fence( std::memory_order_acquire );
+      return sequence.load( std::memory_order_relaxed ) == s; // :`false` - result discarded, retry
+    }
+    template< typename F > bool write( F&& f ){
+      uint64_t s{ sequence.load( std::memory_order_relaxed ) };
+      for( unsigned spin = 0; ( s & 1 ) or not sequence.compare_exchange_weak( s, s + 1, std::memory_order_acquire ); spin++ ){
+        if( spin < 64 ) relax(); else std::this_thread::yield();
+        s = sequence.load( std::memory_order_relaxed );
+      }
+      std::atomic_thread_fence( std::memory_order_release );
+      f( cells );
+      sequence.store( s + 2, std::memory_order_release );
+      return true;
+    }
+  };
+
+  struct Tally {
+    alignas( 64 ) uint64_t ops;  // :successful operations
+    uint64_t               denied;
+    double                 cpu;  // :thread CPU time, nanosec
+  };
+
+  double threadCPU(){
+    timespec t;
+    clock_gettime( CLOCK_THREAD_CPUTIME_ID, &t );
+    return 1.0e9*t.tv_sec + t.tv_nsec;
+  }
+
+  struct Point {
+    double rate;     // :successful operations per second
+    double jain;     // :fairness index, 1 is perfect
+    double spread;   // :max/min per-thread operations
+    double denial;   // :denied fraction of attempts
+    double cpu;      // :CPU nanosec per successful operation
+  };
+
+  template< typename Lock > Point measure( unsigned threads, unsigned cs, double reads, unsigned duration ){
+    auto L = std::make_unique< Lock >();
+    std::vector< Tally >       tally( threads, Tally{ 0, 0, 0.0 } );
+    std::atomic< unsigned >    ready{ 0 };
+    std::atomic< bool >        go   { false };
+    std::atomic< bool >        stop { false };
+    std::vector< std::thread > T;
+    const uint64_t THRESHOLD{ uint64_t( reads*double( UINT64_MAX ) ) };
+    for( unsigned t = 0; t < threads; t++ ){
+      T.emplace_back( [&, t]{
+        Tally    my{ 0, 0, 0.0 };
+        uint64_t x { 0x9E3779B97F4A7C15ull*( t + 1 ) };
+        uint64_t sum{ 0 };
+        ready++;
+        while( not go.load() ) std::this_thread::yield();
+        const double cpu0{ threadCPU() };
+        while( not stop.load( std::memory_order_relaxed ) ){
+          x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+          bool done;
+          if( x < THRESHOLD ){
+            uint64_t s{ 0 };
+            done = L->read( [&]( const Cells& C ){ for( unsigned i = 0; i < cs; i++ ) s += C.word[i].load( std::memory_order_relaxed ); } );
+            if( done ) sum += s;
+          } else {
+            done = L->write( [&]( Cells& C ){
+              for( unsigned i = 0; i < cs; i++ ) C.word[i].store( C.word[i].load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+            });
+          }
+          if( done ) my.ops++; else my.denied++;
+        }
+        my.cpu = threadCPU() - cpu0;
+        tally[t] = my;
+        if( sum == 42 ) printf( " " ); // :keep reads alive
+      });
+    }
+    while( ready.load() < threads ) std::this_thread::yield();
+    Timer timer;
+    go.store( true );
+    CoreAGI::pause{ duration }[ MILLISEC ];
+    stop.store( true );
+    for( auto& t: T ) t.join();
+    const double elapsed{ timer.stop().sec() };
+
+    double ops{ 0 }, squares{ 0 }, denied{ 0 }, cpu{ 0 }, low{ 1e300 }, high{ 0 };
+    for( auto& my: tally ){
+      ops += my.ops; squares += double( my.ops )*my.ops; denied += my.denied; cpu += my.cpu;
+      low = std::min( low, double( my.ops ) ); high = std::max( high, double( my.ops ) );
+    }
+    return Point{ ops/elapsed, squares > 0 ? ops*ops/( threads*squares ) : 0.0, low > 0 ? high/low : 0.0,
+                  ops + denied > 0 ? denied/( ops + denied ) : 0.0, ops > 0 ? cpu/ops : 0.0 };
+  }
+
+  std::vector< double > list( const char* s ){
+    std::vector< double > V;
+    for( ; s and *s; ){ V.push_back( atof( s ) ); s = strchr( s, ',' ); if( s ) s++; }
+    return V;
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  std::vector< double > THREADS, CS{ 10, 100, 1000 }, READS{ 0.5, 0.9, 0.99 };
+  unsigned    DURATION{ 200 };
+  std::string FORMAT{ "text" }, OUTPUT{ "lock.bench.csv" };
+  for( int i = 1; i < argc; i++ ){
+    const char* eq = strchr( argv[i], '=' );
+    const std::string key( argv[i], eq ? eq - argv[i] : strlen( argv[i] ) );
+    const char* value{ eq ? eq + 1 : "" };
+    if     ( key == "threads"  ) THREADS  = list( value );
+    else if( key == "cs"       ) CS       = list( value );
+    else if( key == "reads"    ) READS    = list( value );
+    else if( key == "duration" ) DURATION = unsigned( atoi( value ) );
+    else if( key == "format"   ) FORMAT   = value;
+    else if( key == "output"   ) OUTPUT   = value;
+    else {
+      fprintf( stderr, "Usage: lock.bench [ threads=1,2,4 cs=10,100,1000 reads=0.5,0.9,0.99 duration= format=text|csv output= ]\n" );
+      return 1;
+    }
+  }
+  if( THREADS.empty() ) for( unsigned n = 1; n <= std::max( 1u, std::thread::hardware_concurrency() ); n *= 2 ) THREADS.push_back( n );
+  for( auto& cs: CS ) cs = std::clamp( cs, 1.0, double( CAPACITY ) );
+
+  auto log = logger.log( "bench" );
+  FILE* out{ nullptr };
+  if( FORMAT == "csv" ){
+    out = fopen( OUTPUT.c_str(), "w" );
+    if( not out ){ log.vital( kit( "can`t open %s", OUTPUT.c_str() ) ); return 1; }
+    fprintf( out, "primitive,threads,cs,reads,rate,jain,spread,denial,cpu_ns_per_op\n" );
+  }
+  log.vital( kit( "%u millisec per point, %u hardware threads", DURATION, std::thread::hardware_concurrency() ) );
+
+  auto row = [&]( const char* name, unsigned threads, unsigned cs, double reads, const Point& p ){
+    log.vital( kit( "  %-8s %3u threads  cs %5u  reads %5.3f  %12.0f ops/sec  jain %5.3f  spread %7.2f  denied %6.2f %%  cpu %9.1f ns/op",
+                    name, threads, cs, reads, p.rate, p.jain, p.spread, 100.0*p.denial, p.cpu ) );
+    if( out ){
+      fprintf( out, "%s,%u,%u,%.4f,%.1f,%.4f,%.3f,%.6f,%.1f\n", name, threads, cs, reads, p.rate, p.jain, p.spread, p.denial, p.cpu );
+      fflush( out );
+    }
+  };
+
+  for( double cs: CS ) for( double reads: READS ) for( double threads: THREADS ){
+    const unsigned n{ unsigned( threads ) }, c{ unsigned( cs ) };
+    row( FluidLock  ::NAME, n, c, reads, measure< FluidLock   >( n, c, reads, DURATION ) );
+    row( SharedMutex::NAME, n, c, reads, measure< SharedMutex >( n, c, reads, DURATION ) );
+    row( Mutex      ::NAME, n, c, reads, measure< Mutex       >( n, c, reads, DURATION ) );
+    row( TicketLock ::NAME, n, c, reads, measure< TicketLock  >( n, c, reads, DURATION ) );
+    row( SeqLock    ::NAME, n, c, reads, measure< SeqLock     >( n, c, reads, DURATION ) );
+  }
+  if( out ) fclose( out );
+  log.flush();
+
+  CoreAGI::pause{ 100 }[ MILLISEC ];
+
+  return 0;
+}
@@ -9,74 +9,449 @@
 
  2023.05.04  Initial version
 
+ 2026.10.18  Scheduling attributes: priority, period, relative deadline and per-step budget;
+             deadline misses and budget overruns counted in `Statistics`
+
+ 2026.10.18  Step that can`t get access to a Fluid may `block` on it: the process leaves
+             the runnable set, parks on the Fluid`s wait-list and resumed by its
+             `Dispatcher` (Staff) when access released
+
+ 2026.10.18  Statistics counters are 64-bit and sharded by threads; aggregated on reading
+
+ 2026.10.18  Statistics shards indexed by Staff member (exact counts regardless of number of
+             threads ever created); other threads share atomic shard
+
+ 2026.10.18  Latency histograms (see `histogram.h`) of step duration, queueing delay (from
+             becoming runnable to step start) and interval between step starts; steps timed
+             by the common clock `LogicalProcess::now()` shared with `Staff`
+
+ 2026.10.18  Process can be retired from running Staff: `retire()` marks it, executor drops it
+             from the runnable set at the next occasion (parked process withdrawn from the
+             Fluid`s wait-list)
+
+ 2026.10.18  Execution quantum: occupied process executes up to `Quantum::steps` consecutive
+             steps while they are DONE and `Quantum::slice` not expired
+
+ 2026.10.18  Process can block on any `WaitList` (Fluid or Mailbox)
+
+ 2026.10.18  Timers: step can postpone the next one (`scheduleAt`), periodic process defined
+             by `every`; executor keeps process off the runnable set until the time comes
+             (see timing wheel of `StaffCore`); expired timeout reported by `timedOut`
+
+ 2026.10.18  Executor thread may expose the step it executes in own `Occupancy` slot sampled by
+             observers (see `watchdog.h`); steps of process numbered
+
+ 2026.10.18  Placement hints kept by executor: member that executed the last step and the Fluid
+             accessed by consecutive steps (see `Locality`)
+
+ 2026.10.18  Step called through `Step` (plain function pointer and body address); body can be
+             referenced (`std::ref`) instead of wrapped into `std::function`; compile-time
+             tables of processes see `process.table.h`
+
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef LOGICALPROCESS_H_INCLUDED
 #define LOGICALPROCESS_H_INCLUDED
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 
+#include "config.h"
+#include "fluid.h"
+#include "histogram.h"
 #include "logger.h"
+#include "semantic.type.h"
 
 namespace CoreAGI {
 
   using Log = Logger::Log;
 
+  class LogicalProcess;
+                                                                                                                              /*
+  Executor of logical processes (see `staff.h`) that accepts parked processes back:
+                                                                                                                              */
+  struct Dispatcher {
+    virtual void resume( const LogicalProcess* process ) = 0;
+  };
 
-  class LogicalProcess {
+
+  class LogicalProcess: public Waiter {
   public:
 
     struct Statistics {
-
+                                                                                                                              /*
+      Counters sharded by executor threads: Staff member `m` increments counters of own
+      shard `m + 1` (own cache line) by plain load/store (no read-modify-write, no cross-core
+      invalidations); other threads (and members beyond SHARDS - 1) share shard 0 updated
+      by atomic increment, so every update is exact. Shards are summed only when counters
+      are read. Process counters are updated by members of the single Staff the process
+      belongs to, so no two threads own the same shard:
+                                                                                                                              */
       enum RESULT: unsigned { IDLE=0, BUSY=1, DONE=2, FAIL=3 };
+      enum EVENT : unsigned {
+        LATE=4, // :steps finished after deadline
+        OVER=5, // :steps exceeded time budget
+        WAIT=6  // :steps finished by parking on a Fluid
+      };
+
+      static constexpr unsigned SIZE  { 7                                   };
+      static constexpr unsigned SHARDS{ Config::statistics::SHARD_CAPACITY };
+
+      static_assert( ( SHARDS & ( SHARDS - 1 ) ) == 0 );
+
+      struct alignas( 64 ) Shard {
+        std::atomic< uint64_t > N[ SIZE ];
+      };
+
+      Shard shard[ SHARDS ];
+
+      inline static thread_local unsigned own{ 0 }; // :shard of the current thread, 0 means shared
+
+      static void attach( unsigned member ){ own = member + 1 < SHARDS ? member + 1 : 0; } // :called by Staff member thread
+      static void detach(                 ){ own = 0;                                  }
+
+      void bump( unsigned i ){
+        const unsigned s{ own };
+        std::atomic< uint64_t >& n = shard[s].N[i];
+        if( s == 0 ) n.fetch_add( 1, std::memory_order_relaxed );
+        else         n.store( n.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+      }
+
+      void operator+= ( const RESULT& result ){ bump( unsigned( result ) ); }
+      void operator+= ( const EVENT&  event  ){ bump( unsigned( event  ) ); }
 
-      std::atomic< unsigned > N[4];
+      uint64_t sum( unsigned i ) const {
+        uint64_t n{ 0 };
+        for( const auto& S: shard ) n += S.N[i].load( std::memory_order_relaxed );
+        return n;
+      }
 
-      void operator+= ( const RESULT& result ){ N[ unsigned( result ) ]++; }
+      uint64_t operator[] ( const RESULT& result ) const { return sum( unsigned( result ) ); }
+      uint64_t operator[] ( const EVENT&  event  ) const { return sum( unsigned( event  ) ); }
 
-      void expose( const Log& log, const char* header = "Statistics:" ){
-        const constexpr char* LEX[4]{ "Idle", "Busy", "Done", "Deny" };
-        unsigned M[4];
-        for( unsigned i = 0; i < 4; i++ ) M[i] = N[i].load();
+      void expose( const Log& log, const char* header = "Statistics:" ) const {
+        const constexpr char* LEX[ SIZE ]{ "Idle", "Busy", "Done", "Deny", "Late", "Over", "Wait" };
+        unsigned long long M[ SIZE ];
+        for( unsigned i = 0; i < SIZE; i++ ) M[i] = sum( i );
         log.vital( header );
         double fraction = 100.0*M[IDLE]/( M[IDLE] + M[BUSY] + M[DONE] + M[FAIL] );
-        log.vital( kit( "  %s      %6.2f %%  %10u", LEX[IDLE], fraction, M[IDLE] ) );
+        log.vital( kit( "  %s      %6.2f %%  %10llu", LEX[IDLE], fraction, M[IDLE] ) );
         fraction = 100.0*M[BUSY]/( M[BUSY] + M[DONE] + M[FAIL] );
-        log.vital( kit( "    %s    %6.2f %%  %10u", LEX[BUSY], fraction, M[BUSY] ) );
+        log.vital( kit( "    %s    %6.2f %%  %10llu", LEX[BUSY], fraction, M[BUSY] ) );
         fraction = 100.0*M[DONE]/( M[DONE] + M[FAIL] );
-        log.vital( kit( "      %s  %6.2f %%  %10u", LEX[DONE], fraction, M[DONE] ) );
+        log.vital( kit( "      %s  %6.2f %%  %10llu", LEX[DONE], fraction, M[DONE] ) );
         fraction = 100.0*M[FAIL]/( M[DONE] + M[FAIL] );
-        log.vital( kit( "      %s  %6.2f %%  %10u", LEX[FAIL], fraction, M[FAIL] ) );
+        log.vital( kit( "      %s  %6.2f %%  %10llu", LEX[FAIL], fraction, M[FAIL] ) );
+        if( M[WAIT] > 0 ){
+          fraction = 100.0*M[WAIT]/M[FAIL];
+          log.vital( kit( "        %s  %6.2f %%  %10llu", LEX[WAIT], fraction, M[WAIT] ) );
+        }
+        if( M[LATE] + M[OVER] == 0 ) return;
+        fraction = 100.0*M[LATE]/M[DONE];
+        log.vital( kit( "      %s  %6.2f %%  %10llu", LEX[LATE], fraction, M[LATE] ) );
+        fraction = 100.0*M[OVER]/( M[DONE] + M[FAIL] );
+        log.vital( kit( "      %s  %6.2f %%  %10llu", LEX[OVER], fraction, M[OVER] ) );
       }
 
     };// Statistics
 
+    struct Latency {
+                                                                                                                              /*
+      Nanosecond histograms written only by the thread that occupies the process:
+                                                                                                                              */
+      Histogram<> step;     // :step duration
+      Histogram<> delay;    // :from becoming runnable to step start
+      Histogram<> interval; // :between starts of the consecutive steps
+
+      void expose( const Log& log, const char* header = "Latency, microsec:" ) const {
+        log.vital( kit( "%-36s %9s %9s %9s %9s %9s", header, "p50", "p90", "p99", "p99.9", "max" ) );
+        auto row = [&]( const char* title, const Histogram<>& H ){
+          if( H.count() == 0 ) return;
+          log.vital( kit( "  %-34s %9.1f %9.1f %9.1f %9.1f %9.1f", title,
+                          1.0e-3*H.quantile( 0.5 ), 1.0e-3*H.quantile( 0.9 ), 1.0e-3*H.quantile( 0.99 ),
+                          1.0e-3*H.quantile( 0.999 ), 1.0e-3*H.max() ) );
+        };
+        row( "step",     step     );
+        row( "delay",    delay    );
+        row( "interval", interval );
+      }
+
+    };// Latency
+
+    struct Occupancy {
+                                                                                                                              /*
+      Slot of executor thread that describes the step executed now; written by the thread
+      only and sampled by observers. `serial` is odd while step runs; payload changes only
+      while it is even, so observer that read the same odd serial before and after payload
+      got consistent picture (sequence lock without retries on the writer side):
+                                                                                                                              */
+      std::atomic< uint64_t >              serial { 0       };
+      std::atomic< const LogicalProcess* > process{ nullptr };
+      std::atomic< const char* >           name   { nullptr };
+      std::atomic< double >                budget { 0       }; // :nanosec, 0 if not defined
+      std::atomic< double >                start  { 0       }; // :step start, nanosec of `LogicalProcess::now()`
+      std::atomic< uint64_t >              step   { 0       }; // :index of the step in the process
+
+      void enter( double t, uint64_t index ){
+        start.store( t,     std::memory_order_relaxed );
+        step .store( index, std::memory_order_relaxed );
+        serial.store( serial.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+      }
+
+      void leave(){
+        serial.store( serial.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release ); // :next payload stores not visible before
+      }
+    };
+
+    struct Locality {
+                                                                                                                              /*
+      Placement hints maintained by executor (see `StaffCore`); `member` read by any thread
+      that resumes the process, the rest touched by the occupant only:
+                                                                                                                              */
+      std::atomic< int > member  { -1      }; // :member executed the last step
+      const FluidCore*   resource{ nullptr }; // :Fluid accessed by the last steps
+      unsigned           streak  { 0       }; // :consecutive steps accessed `resource`
+    };
+
+    struct Schedule {
+                                                                                                                              /*
+      Scheduling attributes used by `Staff` with `Dispatch::DEADLINE` policy (see `staff.h`).
+      Zero duration means `not defined`. Step of periodic process released every `period`;
+      absolute deadline is release time plus `deadline` (or plus `period` if deadline not
+      defined). Processes without deadline are ordered by priority after all processes
+      that have deadline:
+                                                                                                                              */
+      unsigned priority; // :larger is more important
+      Duration period;   // :release period
+      Duration deadline; // :relative deadline
+      Duration budget;   // :max duration of a single step
+
+      bool timed() const { return period.endo() > 0 or deadline.endo() > 0 or budget.endo() > 0; }
+    };
+
+    struct Quantum {
+                                                                                                                              /*
+      Steps executed per single occupation of the process: the occupation (two CAS on `vacant`
+      and dispatching by executor) is paid once for up to `steps` consecutive DONE steps or,
+      if `slice` defined, until the slice expired. Periodic process executes single step per
+      release regardless of quantum:
+                                                                                                                              */
+      unsigned steps; // :max consecutive steps, 1 means single step per occupation
+      Duration slice; // :time slice, zero means `not limited`
+    };
+
+    struct Step {
+                                                                                                                              /*
+      Step entry: `call( body, log )`, where `call` is generated for the body type, so the
+      body itself is called directly (and can be inlined) there:
+                                                                                                                              */
+      bool ( *call )( void* body, const Log& log );
+      void*  body;
+    };
+
+    template< typename B > static bool invoke( void* body, const Log& log ){
+      return bool( ( *static_cast< B* >( body ) )( log ) );
+    }
+
   protected:
 
-    const   char*                       ID;     // :process name (useful for logging)
-    std::function< bool( const Log& ) > F;      // :process function
-    mutable std::atomic< bool >         vacant; // :busy/vacant flag
-    mutable std::atomic< bool >         active; // :idle/active flag
+    const   char*                       ID;         // :process name (useful for logging)
+    std::function< bool( const Log& ) > F;          // :process function owned by the process, if any
+    Step                                S;          // :step entry
+    mutable std::atomic< bool >         vacant;     // :busy/vacant flag
+    mutable std::atomic< bool >         active;     // :idle/active flag
     mutable Statistics                  stat;
+    mutable Latency                     latency;
+    mutable Timepoint                   readied;    // :when became runnable (zero if unknown)
+    mutable Timepoint                   started;    // :start of the last step
+    mutable Timepoint                   finished;   // :finish of the last step
+    Schedule                            plan;       // :scheduling attributes
+    Quantum                             quota;      // :steps per occupation
+    mutable Timepoint                   released;   // :release time of the next step
+    mutable Timepoint                   due;        // :absolute deadline of the next step
+    mutable uint64_t                    ticket;     // :FIFO order among equal deadlines and priorities
+    mutable Dispatcher*                 dispatcher; // :executor that resumes parked process
+    mutable const WaitList*             blocker;    // :Fluid (Mailbox) the last step blocked on
+    mutable WaitList::Access            access;     // :access mode the last step blocked for
+    mutable std::atomic< const WaitList* > parking; // :Fluid (Mailbox) the process parked on
+    mutable std::atomic< bool >         leaving;    // :retirement requested
+    mutable Timepoint                   alarm;      // :next step not before this time (zero if not set)
+    mutable std::atomic< bool >         expired;    // :timeout expired while parked
+    mutable uint64_t                    executed;   // :number of steps executed, written by the occupant only
+    mutable Locality                    locality;   // :placement hints of the executor
+
+    inline static thread_local const LogicalProcess* running{ nullptr }; // :process executed by current thread
+    inline static const Chronos                      clock{};            // :time base of steps and schedules
+    inline static thread_local Occupancy*            occupant{ nullptr }; // :slot of current executor thread, if exposed
 
   public:
                                                                                                                               /*
     Constructor accepts function as an argument:
                                                                                                                               */
-    LogicalProcess( const char* name, std::function< bool( const Log& ) > f ): ID{ name }, F{ f }, stat{}{
+    LogicalProcess( const char* name, std::function< bool( const Log& ) > f ):
+      LogicalProcess( name, Step{ &invoke< std::function< bool( const Log& ) > >, nullptr } )
+    {
+      F = std::move( f );
+      S.body = &F;
+    }
+                                                                                                                              /*
+    Body referenced, not copied (it has to outlive the process), e.g. `LogicalProcess P( "P", std::ref( S ) )`
+    for object `S` having `operator()( const Log& )`:
+                                                                                                                              */
+    template< typename B > LogicalProcess( const char* name, std::reference_wrapper< B > body ):
+      LogicalProcess( name, Step{ &invoke< B >, const_cast< void* >( static_cast< const void* >( &body.get() ) ) } ){}
+
+    LogicalProcess( const char* name, const Step& step ):
+      ID{ name }, F{}, S{ step }, stat{}, latency{}, readied{}, started{}, finished{}, plan{ 0, {}, {}, {} }, quota{ 1, {} }, released{}, due{}, ticket{ 0 },
+      dispatcher{ nullptr }, blocker{ nullptr }, access{ WaitList::Access::WRITE }, parking{ nullptr }, leaving{ false },
+      alarm{}, expired{ false }, executed{ 0 }, locality{}
+    {
       vacant.store( true  ); // :vacant at the start
       active.store( false ); // :idle   at the start
     }
 
-    void start() const { active.store( true  ); }
+    static Timepoint now(){ return Timepoint{ clock }; }
+
+    static void occupy( Occupancy* slot ){ occupant = slot; } // :called by executor thread to expose its steps
+
+    void start() const { readied = now(); active.store( true  ); }
     void stop () const { active.store( false ); }
 
-    const char* name() const { return ID;            }
-    bool        live() const { return active.load(); }
+    const char*       name      () const { return ID;            }
+    bool              live      () const { return active.load(); }
+    const Statistics& statistics() const { return stat;          }
+    const Latency&    latencies () const { return latency;       }
+    uint64_t          stepIndex () const { return executed;      } // :exact for the occupant only
+    Locality&         placement () const { return locality;      }
+
+    void             schedule( const Schedule& S )       { plan = S;             }
+    const Schedule&  schedule(                   ) const { return plan;          }
+    unsigned         priority(                   ) const { return plan.priority; }
+    void             every   ( const Duration& T )       { plan.period = T;      }
+    void             quantum ( const Quantum&  Q )       { quota = Q;            }
+    const Quantum&   quantum (                   ) const { return quota;         }
+    const Timepoint& release (                   ) const { return released;      }
+    const Timepoint& deadline(                   ) const { return due;           }
+    uint64_t         order   (                   ) const { return ticket;        }
+
+    void assign( Dispatcher* D ) const { dispatcher = D; }
+
+    void ready( const Timepoint& t ) const { readied = t; } // :called by executor when process becomes runnable
+
+    static bool block( const WaitList& fluid, const WaitList::Access& mode = WaitList::Access::READ ){
+                                                                                                                              /*
+      Called from the step of the running process when access to `fluid` denied (or
+      mailbox is empty, see `mailbox.h`):
+
+        if( not data.alter( ... ) ) return LogicalProcess::block( data, FluidCore::Access::WRITE );
+
+      Step result is `false`; executor parks the process instead of retrying it:
+                                                                                                                              */
+      if( running ){
+        running->blocker = &fluid;
+        running->access  = mode;
+      }
+      return false;
+    }
+
+    bool blocked() const { return blocker != nullptr; }
+    bool parked () const { return parking.load( std::memory_order_relaxed ) != nullptr; }
+
+    static bool scheduleAt( const Timepoint& t ){
+                                                                                                                              /*
+      Called from the step of the running process: the next step not before `t`:
+
+        return LogicalProcess::scheduleAt( LogicalProcess::now() + Duration::Value{ 5.0 }[ MILLISEC ] );
+                                                                                                                              */
+      if( running ) running->alarm = t;
+      return true;
+    }
+
+    Timepoint wakeup() const {
+                                                                                                                              /*
+      Time the next step is due (zero if not postponed); alarm consumed:
+                                                                                                                              */
+      Timepoint t{ alarm };
+      alarm = Timepoint{};
+      if( plan.period.endo() > 0 and released > t ) t = released;
+      return Timepoint{ t };
+    }
+
+    void expire  () const { expired.store( true );         } // :called by executor when timeout fired
+    bool timedOut() const { return expired.exchange( false ); }
+
+    void retire() const { leaving.store( true );  } // :request removal from the executor
+    bool retiring() const { return leaving.load(); }
+
+    bool withdraw() const {
+                                                                                                                              /*
+      Take parked process back from the Fluid`s wait-list; `false` if it is not parked or
+      is being woken up (then it comes back to the executor anyway). Of concurrent callers
+      at most one succeeds:
+                                                                                                                              */
+      const WaitList* fluid{ parking.exchange( nullptr ) };
+      return fluid and fluid->unpark( this );
+    }
+
+    bool park() const {
+                                                                                                                              /*
+      Called by executor after blocked step; the process may be resumed (even by another
+      thread) before this call returns, so caller must not touch the process after it
+      returned `true`. Process being retired taken back and `false` returned, then caller
+      retires it. Reading `leaving` after parking is safe since executor frees retired
+      processes only after all its threads passed the step (see `StaffCore::collect`):
+                                                                                                                              */
+      const WaitList* fluid{ blocker };
+      assert( fluid );
+      blocker = nullptr;
+      stat += Statistics::WAIT;
+      parking.store( fluid );
+      fluid->park( this, access );
+      return not ( leaving.load() and withdraw() );
+    }
+
+    void wake() const override {
+      parking.store( nullptr );
+      readied = now();
+      if( dispatcher ) dispatcher->resume( this );
+    }
+
+    void release( const Timepoint& now, uint64_t order ) const {
+                                                                                                                              /*
+      Make the next step released at `now`:
+                                                                                                                              */
+      released = now;
+      ticket   = order;
+      const double D{ plan.deadline.endo() > 0 ? plan.deadline.endo() : plan.period.endo() };
+      due = Timepoint::Value{ D > 0 ? now.nsec() + D : INFINITY }[ NANOSEC ];
+    }
+
+    void account( const Statistics::RESULT& result, uint64_t order ) const {
+                                                                                                                              /*
+      Count deadline miss and budget overrun of the step just executed, then define release
+      time and deadline of the next one. Failed (denied) step retried with the same deadline:
+                                                                                                                              */
+      ticket = order;
+      if( result != Statistics::DONE and result != Statistics::FAIL ) return; // :not executed
+      if( plan.budget.endo() > 0 and ( finished - started ) > plan.budget ) stat += Statistics::OVER;
+      if( result != Statistics::DONE ) return;
+      if( finished > due ) stat += Statistics::LATE;
+      if( plan.period.endo() > 0 ){
+        Timepoint next{ released + plan.period };
+        if( next < finished - plan.period ) next = finished; // :too late, skip missed periods
+        release( next, order );
+      } else {
+        release( finished, order );
+      }
+    }
 
     auto info( const Log& log ) const {
       stat.expose( log, ( std::string( "Process `" ) + std::string( ID ) + "` statistics:" ).c_str() );
+      if( latency.step.count() > 0 ) latency.expose( log, ( std::string( "Process `" ) + std::string( ID ) + "` latency, microsec:" ).c_str() );
     }
 
     Statistics::RESULT process( [[maybe_unused]] const Log& log ) const {
@@ -93,11 +468,49 @@ namespace CoreAGI {
         return  Statistics::BUSY;
       }
                                                                                                                               /*
-      Process occupied succesfully; run next step of the logical process:
+      Process occupied succesfully; run next steps of the logical process. Finish of a step
+      is the start of the next one, so timing costs one clock reading per step:
                                                                                                                               */
       Statistics::RESULT result;
-      if( F( log ) ) stat += Statistics::DONE, result = Statistics::DONE;
-      else           stat += Statistics::FAIL, result = Statistics::FAIL;
+      Occupancy*     const slot  { occupant };
+      const bool           sliced{ quota.slice.endo() > 0 };
+      const bool           timing{ Config::statistics::TIMING or plan.timed() or sliced or slot };
+      const unsigned       steps { plan.period.endo() > 0 ? 1 : std::max( 1u, quota.steps ) };
+      Timepoint      first;
+      if( timing ){
+        first = now();
+        if( started .nsec() > 0 ) latency.interval.record( ( first - started ).endo() );
+        if( readied .nsec() > 0 ) latency.delay   .record( ( first - readied ).endo() );
+        started = first;
+      }
+      if( slot ){
+        slot->process.store( this,                std::memory_order_relaxed );
+        slot->name   .store( ID,                  std::memory_order_relaxed );
+        slot->budget .store( plan.budget.endo(),  std::memory_order_relaxed );
+      }
+      running = this;
+      for( unsigned n = 1;; n++ ){
+        blocker = nullptr;
+        executed++;
+        if( slot ) slot->enter( started.nsec(), executed );
+        if( S.call( S.body, log ) ) stat += Statistics::DONE, result = Statistics::DONE;
+        else           stat += Statistics::FAIL, result = Statistics::FAIL;
+        if( slot ) slot->leave();
+        if( timing ){
+          finished = readied = now();
+          latency.step.record( ( finished - started ).endo() );
+        }
+        if( result != Statistics::DONE or n >= steps ) break;
+        if( not active.load( std::memory_order_relaxed ) or leaving.load( std::memory_order_relaxed ) ) break;
+        if( alarm.nsec() > 0 ) break; // :step postponed the next one
+        if( sliced and finished - first >= quota.slice ) break;
+        if( timing ){
+          latency.interval.record( ( finished - started ).endo() );
+          started = finished;
+        }
+      }
+      running = nullptr;
+      if( result == Statistics::DONE or not dispatcher ) blocker = nullptr; // :nobody to resume the process, retry instead
                                                                                                                               /*
       Make process vacant (ready to execution by any thread):
                                                                                                                               */
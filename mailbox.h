@@ -0,0 +1,152 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Typed bounded mailbox of a logical process: any thread (process) sends messages,
+ the owner process receives them in batches. Based on circular buffer with per-slot
+ sequence numbers, so neither sending nor receiving locks (see D.Vyukov`s bounded
+ MPMC queue); capacity N is a power of 2.
+
+ Receiver that found mailbox empty blocks on it and leaves the runnable set; the
+ next message sent makes it runnable again:
+
+   Mailbox< Message, 256 > inbox;
+
+   LogicalProcess consumer( "consumer", [&]( const Log& log )->bool {
+     if( inbox.receive( [&]( Message&& m ){ ... }, 32 ) == 0 ) return LogicalProcess::block( inbox );
+     return true;
+   });
+
+   LogicalProcess producer( "producer", [&]( const Log& log )->bool {
+     return inbox.send( Message{ ... } ); // :`false` if mailbox full, retried at the next step
+   });
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef MAILBOX_H_INCLUDED
+#define MAILBOX_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <optional>
+#include <utility>
+
+#include "fluid.h"
+
+namespace CoreAGI {
+
+  template< typename T, unsigned N > requires std::default_initializable< T > and std::movable< T >
+  class Mailbox: public WaitList {
+
+    static_assert( std::has_single_bit( N ) );
+
+    static constexpr uint64_t MASK{ N - 1 };
+
+    struct alignas( 64 ) Slot {
+      std::atomic< uint64_t > seq;     // :== position: vacant for sending; == position + 1: holds message
+      std::optional< T >      message;
+    };
+
+    Slot                                slot[ N ];
+    alignas( 64 ) std::atomic< uint64_t > head; // :next position to send
+    alignas( 64 ) std::atomic< uint64_t > tail; // :next position to receive
+
+    template< typename U > bool put( U&& m ){
+      uint64_t pos{ head.load( std::memory_order_relaxed ) };
+      for(;;){
+        Slot& S = slot[ pos & MASK ];
+        const uint64_t seq{ S.seq.load( std::memory_order_acquire ) };
+        const int64_t  dif{ int64_t( seq ) - int64_t( pos ) };
+        if( dif == 0 ){
+          if( head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ){
+            S.message.emplace( std::forward< U >( m ) );
+            S.seq.store( pos + 1, std::memory_order_release );
+            break;
+          }
+        } else if( dif < 0 ){
+          return false; // :full
+        } else {
+          pos = head.load( std::memory_order_relaxed );
+        }
+      }
+                                                                                                                              /*
+      Message published before the waiters count is read (see `WaitList::notify`):
+                                                                                                                              */
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      notify();
+      return true;
+    }
+
+    bool take( T& m ){
+      uint64_t pos{ tail.load( std::memory_order_relaxed ) };
+      for(;;){
+        Slot& S = slot[ pos & MASK ];
+        const uint64_t seq{ S.seq.load( std::memory_order_acquire ) };
+        const int64_t  dif{ int64_t( seq ) - int64_t( pos + 1 ) };
+        if( dif == 0 ){
+          if( tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ){
+            m = std::move( *S.message );
+            S.message.reset();
+            S.seq.store( pos + N, std::memory_order_release );
+            return true;
+          }
+        } else if( dif < 0 ){
+          return false; // :empty
+        } else {
+          pos = tail.load( std::memory_order_relaxed );
+        }
+      }
+    }
+
+  public:
+
+    Mailbox(): WaitList{}, slot{}, head{ 0 }, tail{ 0 }{
+      for( unsigned i = 0; i < N; i++ ) slot[i].seq.store( i, std::memory_order_relaxed );
+    }
+
+    Mailbox( const Mailbox& )              = delete;
+    Mailbox& operator = ( const Mailbox& ) = delete;
+
+    bool send( const T& m ){ return put( m );            } // :`false` if mailbox full
+    bool send( T&&      m ){ return put( std::move( m ) ); }
+
+    template< typename F > unsigned receive( F&& f, unsigned batch = N ){
+                                                                                                                              /*
+      Pass up to `batch` messages to `f( T&& )`; returns number of received messages:
+                                                                                                                              */
+      unsigned n{ 0 };
+      T m{};
+      while( n < batch and take( m ) ){ f( std::move( m ) ); n++; }
+      return n;
+    }
+
+    std::optional< T > receive(){
+      T m{};
+      if( take( m ) ) return m;
+      return std::nullopt;
+    }
+
+    unsigned size () const { return unsigned( head.load() - tail.load() ); } // :approximate when used concurrently
+    bool     empty() const { return size() == 0;                          }
+
+    bool available( [[maybe_unused]] const Access& access ) const override {
+                                                                                                                              /*
+      Receiver waits for messages:
+                                                                                                                              */
+      const uint64_t pos{ tail.load() };
+      return slot[ pos & MASK ].seq.load() == pos + 1;
+    }
+
+  };//Mailbox
+
+}//namespace CoreAGI
+
+#endif // MAILBOX_H_INCLUDED
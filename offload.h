@@ -0,0 +1,239 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Offload of blocking operations (file I/O, large copies, system calls that may sleep)
+ from logical processes: members of Staff never block, blocking closure executed by the
+ separate pool of threads sized independently of the Staff.
+
+ Step submits closure with the `Offload` handle and finishes waiting: the process parks
+ on the handle (it is a wait-list, see `fluid.h`) and resumed by Staff when the pool
+ completed the job; the next step takes the result:
+
+   OffloadPool       pool( 4 );
+   Offload< size_t > job;
+   LogicalProcess reader( "reader", [&]( const Log& log )->bool {
+     if( job.idle() ) return pool.submit( job, [=]{ return size_t( pread( fd, buffer, N, 0 ) ); } );
+     if( not job.ready() ) return LogicalProcess::block( job ); // :woken up by timeout or so
+     const size_t n{ job.take() };                              // :handle idle again
+     ...
+     return true;
+   });
+
+ Handle must outlive the job. Closures without result use `Offload< bool >` and return
+ `true`. `post` executes closure in the pool without any handle.
+
+ Exception thrown by the closure completes the handle as failed (`failed()`; `take()`
+ rethrows it), so the parked process is resumed anyway; exceptions of closures posted
+ without handle are counted (`failures()`). Pool stopped already doesn`t accept jobs:
+ `post` returns `false`, `submit` fails the handle at once and doesn`t block.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef OFFLOAD_H_INCLUDED
+#define OFFLOAD_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "fluid.h"
+#include "logical.process.h"
+#include "logger.h"
+
+namespace CoreAGI {
+
+  template< typename R > class Offload: public WaitList {
+
+    enum Phase: unsigned { IDLE, PENDING, DONE };
+
+    std::atomic< unsigned > phase;
+    std::optional< R >      result;
+    std::exception_ptr      error; // :thrown by the job instead of result
+
+    friend class OffloadPool;
+    friend class AsyncIO;
+
+    void complete( R&& r ){
+      result.emplace( std::move( r ) );
+      phase.store( DONE ); // :sequentially consistent with `park` (see `WaitList`)
+      notify();            // :resume parked process
+    }
+
+    void fail( std::exception_ptr e ){
+      error = std::move( e );
+      phase.store( DONE );
+      notify();
+    }
+
+  public:
+
+    Offload(): WaitList{}, phase{ IDLE }, result{}, error{} {}
+
+    bool idle   () const { return phase.load( std::memory_order_acquire ) == IDLE;    } // :can be submitted
+    bool pending() const { return phase.load( std::memory_order_acquire ) == PENDING; }
+    bool ready  () const { return phase.load( std::memory_order_acquire ) == DONE;    } // :result can be taken
+    bool failed () const { return ready() and error != nullptr;                       } // :`take` throws
+
+    bool available( const Access& ) const override { return ready(); }
+
+    R take(){
+                                                                                                                              /*
+      Result of the completed job (exception of the failed one rethrown); handle becomes idle:
+                                                                                                                              */
+      assert( ready() );
+      if( error ){
+        std::exception_ptr e{ std::move( error ) };
+        error = nullptr;
+        phase.store( IDLE, std::memory_order_release );
+        std::rethrow_exception( e );
+      }
+      R r{ std::move( *result ) };
+      result.reset();
+      phase.store( IDLE, std::memory_order_release );
+      return r;
+    }
+
+  };//Offload
+
+
+  class OffloadPool {
+
+    const unsigned                        SIZE;
+    std::vector< std::thread >            threads;
+    std::mutex                            guard;     // :protects `queue` and `terminate`
+    std::condition_variable               bell;
+    std::deque< std::function< void() > > queue;
+    bool                                  terminate;
+    std::atomic< uint64_t >               submitted;
+    std::atomic< uint64_t >               completed;
+    std::atomic< uint64_t >               thrown;    // :jobs finished by exception
+    std::atomic< unsigned >               busy;      // :threads executing a job
+
+    void run(){
+      for(;;){
+        std::function< void() > job;
+        {
+          std::unique_lock< std::mutex > lock( guard );
+          bell.wait( lock, [&]{ return terminate or not queue.empty(); } );
+          if( queue.empty() ) return; // :terminated and drained
+          job = std::move( queue.front() );
+          queue.pop_front();
+        }
+        busy++;
+        try {
+          job(); // :jobs of `submit` report exceptions through their handles
+        } catch( ... ){
+          thrown.fetch_add( 1, std::memory_order_relaxed );
+        }
+        busy--;
+        completed.fetch_add( 1, std::memory_order_relaxed );
+      }
+    }
+
+  public:
+
+    explicit OffloadPool( unsigned size = Config::staff::OFFLOAD_THREADS ):
+      SIZE     { std::max( 1u, size ) },
+      threads  {                      },
+      guard    {                      },
+      bell     {                      },
+      queue    {                      },
+      terminate{ false                },
+      submitted{ 0                    },
+      completed{ 0                    },
+      thrown   { 0                    },
+      busy     { 0                    }
+    {
+      for( unsigned i = 0; i < SIZE; i++ ) threads.emplace_back( &OffloadPool::run, this );
+    }
+
+    OffloadPool( const OffloadPool& )              = delete;
+    OffloadPool& operator = ( const OffloadPool& ) = delete;
+
+    unsigned size    () const { return SIZE;              }
+    uint64_t done    () const { return completed.load();  }
+    uint64_t failures() const { return thrown.load();     } // :posted jobs finished by exception
+    unsigned working () const { return busy.load();       }
+    uint64_t backlog () const { return submitted.load() - completed.load(); } // :queued or executed
+
+    bool post( std::function< void() > job ){
+                                                                                                                              /*
+      Execute closure by some thread of the pool; returns `false` (closure dropped) if
+      the pool is stopped:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( guard );
+        if( terminate ) return false;
+        queue.push_back( std::move( job ) );
+        submitted.fetch_add( 1, std::memory_order_relaxed ); // :before any thread can complete it
+      }
+      bell.notify_one();
+      return true;
+    }
+
+    template< typename R, typename F > bool submit( Offload< R >& handle, F&& f ){
+                                                                                                                              /*
+      Called from the step: job started in the pool, process blocks on the handle until
+      the job completed. Returns value of `LogicalProcess::block`, so the step can return it;
+      outside of a step the caller waits by `handle.ready()`. If the pool is stopped the
+      handle is failed at once and `false` returned without blocking (the next step finds
+      the handle ready):
+                                                                                                                              */
+      [[maybe_unused]] const unsigned before{ handle.phase.exchange( Offload< R >::PENDING ) };
+      assert( before == Offload< R >::IDLE );
+      const bool posted{ post( [ &handle, f = std::forward< F >( f ) ]() mutable {
+        try {
+          handle.complete( R( f() ) );
+        } catch( ... ){
+          handle.fail( std::current_exception() );
+        }
+      }) };
+      if( not posted ){
+        handle.fail( std::make_exception_ptr( std::runtime_error( "OffloadPool stopped" ) ) );
+        return false;
+      }
+      return LogicalProcess::block( handle );
+    }
+
+    void info( const Log& log ) const {
+      log.vital( kit( "Offload pool: %u threads, %llu jobs done (%llu posted ones failed), %llu in backlog", SIZE,
+                      (unsigned long long) done(), (unsigned long long) failures(), (unsigned long long) backlog() ) );
+    }
+
+    void stop(){
+                                                                                                                              /*
+      Jobs already submitted are completed (their processes resumed) before threads finish:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( guard );
+        terminate = true;
+      }
+      bell.notify_all();
+      for( auto& t: threads ) if( t.joinable() ) t.join();
+    }
+
+   ~OffloadPool(){ stop(); }
+
+  };//OffloadPool
+
+}//namespace CoreAGI
+
+#endif // OFFLOAD_H_INCLUDED
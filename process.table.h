@@ -0,0 +1,132 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Compile-time table of logical processes: bodies of known types (classes having
+ `operator()( const Log& )` returning `bool` or `int`) stored inline together with their
+ `LogicalProcess` records, no `std::function` and no heap allocation:
+
+   struct Reader{ bool operator()( const Log& log ); ... };
+   struct Writer{ bool operator()( const Log& log ); ... };
+
+   TableStaff< 2, Reader, Writer, Writer > staff( { "R", "W1", "W2" } );
+   staff.body< 1 >().limit = 10;       // :access to the body of "W1"
+   for( auto p: staff.table() ) p->start();
+   staff.start();
+
+ Step entries of the processes taken from the jump table `JUMP` generated for the body
+ types: executor calls the entry, the entry calls the body directly (inlined), so a step
+ costs a single indirect call. Every entry (body and its process record) occupies own
+ cache lines, so processes executed by different members don`t share lines.
+
+ `ProcessTable` can be used alone with any executor (`processes()` is the null-terminated
+ array expected by Staff and Simulation).
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef PROCESS_TABLE_H_INCLUDED
+#define PROCESS_TABLE_H_INCLUDED
+
+#include <array>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "logical.process.h"
+#include "staff.h"
+
+namespace CoreAGI {
+
+  template< typename B > concept ProcessBody = std::is_class_v< B > and requires( B b, const Log& log ){
+    { b( log ) } -> std::convertible_to< bool >;
+  };
+
+  template< ProcessBody... Body > class ProcessTable {
+  public:
+
+    static constexpr unsigned SIZE{ sizeof...( Body ) };
+
+    using Names = std::array< const char*, SIZE >;
+    using Call  = decltype( LogicalProcess::Step::call );
+
+    static constexpr Call JUMP[]{ &LogicalProcess::invoke< Body >... }; // :step entries by body type
+
+  private:
+
+    static_assert( SIZE > 0 );
+
+    template< typename B > struct Seed {
+      const char* name;
+      B&&         body;
+      Call        call;
+    };
+
+    template< typename B > struct alignas( 64 ) Entry {
+      B              body;
+      LogicalProcess process;
+      Entry( Seed< B >&& seed ): body{ std::move( seed.body ) }, process{ seed.name, LogicalProcess::Step{ seed.call, &body } }{}
+    };
+
+    std::tuple< Entry< Body >... > entry;
+    const LogicalProcess*          pointer[ SIZE + 1 ]; // :null-terminated
+
+    template< size_t... I > ProcessTable( std::index_sequence< I... >, const Names& names, Body&&... body ):
+      entry{ Seed< Body >{ names[I], std::move( body ), JUMP[I] }... },
+      pointer{ &std::get< I >( entry ).process..., nullptr }
+    {}
+
+  public:
+
+    ProcessTable( const Names& names, Body... body ):
+      ProcessTable( std::index_sequence_for< Body... >{}, names, std::move( body )... ){}
+
+    explicit ProcessTable( const Names& names ) requires( std::default_initializable< Body > and ... ):
+      ProcessTable( names, Body{}... ){}
+
+    ProcessTable( const ProcessTable& )              = delete;
+    ProcessTable& operator = ( const ProcessTable& ) = delete;
+
+    template< unsigned I > auto&                 body   ()       { return std::get< I >( entry ).body;    }
+    template< unsigned I > const LogicalProcess& process() const { return std::get< I >( entry ).process; }
+
+    const LogicalProcess** processes(){ return pointer; }
+
+    struct View {
+      const LogicalProcess* const* first;
+      const LogicalProcess* const* begin() const { return first;        }
+      const LogicalProcess* const* end  () const { return first + SIZE; }
+    };
+
+    View table() const { return View{ pointer }; } // :for( auto p: table() ) p->start();
+
+  };//ProcessTable
+
+                                                                                                                              /*
+  Staff of STAFF members that owns compile-time table of processes (table constructed
+  before and destroyed after the Staff):
+                                                                                                                              */
+  template< unsigned STAFF, ProcessBody... Body > class TableStaff: public ProcessTable< Body... >, public StaffCore {
+
+    static_assert( STAFF > 0 );
+
+    using Table = ProcessTable< Body... >;
+
+  public:
+
+    TableStaff( const typename Table::Names& names, Body... body, Dispatch dispatch = Dispatch::STEALING ):
+      Table( names, std::move( body )... ), StaffCore( Table::processes(), STAFF, STAFF, STAFF, dispatch ){}
+
+    explicit TableStaff( const typename Table::Names& names, Dispatch dispatch = Dispatch::STEALING )
+      requires( std::default_initializable< Body > and ... ):
+      Table( names ), StaffCore( Table::processes(), STAFF, STAFF, STAFF, dispatch ){}
+
+  };//TableStaff
+
+}//namespace CoreAGI
+
+#endif // PROCESS_TABLE_H_INCLUDED
@@ -7,6 +7,9 @@
  Timer for intervals in sec, millice, microsec, nonesec
 
  2021.10.04
+
+ 2026.10.18  `RANGE` exposes its bounds; `RANGE2D` traverses rectangle of row-major array tile by
+             tile (cache blocking). Parallel execution over ranges see `fork.join.h`
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef RANGE_H_INCLUDED
@@ -14,6 +17,7 @@ ________________________________________________________________________________
 
 #include <cassert>
 #include <concepts>
+#include <type_traits>
 
 template< typename T > concept Sized = requires( T t ){
   t.empty();
@@ -40,6 +44,71 @@ public:
   constexpr RANGE( const Sized auto& data             ): I{ 0    }, N{ data.size() }{ assert( data.size() >= 0    ); }
   constexpr Iter begin(){ return I; }
   constexpr Iter end  (){ return N; }
+  constexpr Elem lower() const { return I.i;       }
+  constexpr Elem upper() const { return N.i;       }
+  constexpr Elem size () const { return N.i - I.i; }
 };//RANGE
 
+                                                                                                                              /*
+  Cells `[ row, col ]` of the rectangle [ row0, row1 ) x [ col0, col1 ) visited tile by tile:
+  tiles of TR rows and TC columns are visited in row-major order, cells of a tile in
+  row-major order too, so the tile (and cache lines of its rows) stays in cache while
+  processed:
+
+    double R[L][L], T[L][L];
+    for( auto [ i, j ]: RANGE2D( L, L, 32, 32 ) ) T[j][i] = R[i][j]; // :blocked transposition
+
+  Tiles can be taken separately (e.g. executed in parallel, see `fork.join.h`) as
+  `tile( k )` for k in RANGE( tiles() ):
+                                                                                                                              */
+template< std::integral Elem = unsigned > class RANGE2D {
+public:
+  struct Cell { Elem row, col; };
+private:
+  Elem ROW0, ROW1, COL0, COL1; // :bounds
+  Elem TR, TC;                 // :tile size
+  struct Iter {
+    const RANGE2D* R;
+    Elem           row, col;   // :current cell
+    Elem           tr,  tc;    // :origin of the current tile
+    constexpr Cell  operator*  (               ) const { return Cell{ row, col };                    }
+    constexpr bool  operator== ( const Iter& x ) const { return row == x.row and col == x.col;        }
+    constexpr bool  operator!= ( const Iter& x ) const { return not( *this == x );                    }
+    constexpr Iter& operator++ (){
+      if( ++col < R->edge( tc, R->TC, R->COL1 ) ) return *this;
+      col = tc;
+      if( ++row < R->edge( tr, R->TR, R->ROW1 ) ) return *this;
+      tc += R->TC;                                 // :next tile of the same tile row
+      if( tc >= R->COL1 ){ tc = R->COL0; tr += R->TR; }
+      if( tr >= R->ROW1 ){ row = R->ROW1; col = R->COL0; return *this; } // :end
+      row = tr; col = tc;
+      return *this;
+    }
+  };
+  static constexpr Elem edge( Elem origin, Elem size, Elem bound ){ return bound - origin > size ? origin + size : bound; }
+  static constexpr Elem count( Elem from, Elem upto, Elem size ){ return ( upto - from + size - 1 )/size; }
+public:
+  using Size = std::type_identity_t< Elem >; // :tile size doesn`t take part in deduction of `Elem`
+  constexpr RANGE2D( Elem rows, Elem cols, Size tileRows, Size tileCols ):
+    RANGE2D( RANGE< Elem >( rows ), RANGE< Elem >( cols ), tileRows, tileCols ){}
+  constexpr RANGE2D( const RANGE< Elem >& rows, const RANGE< Elem >& cols, Size tileRows, Size tileCols ):
+    ROW0{ rows.lower() }, ROW1{ rows.upper() }, COL0{ cols.lower() }, COL1{ cols.upper() }, TR{ tileRows }, TC{ tileCols }
+  {
+    assert( TR > 0 and TC > 0 );
+    if( ROW0 == ROW1 or COL0 == COL1 ) ROW0 = ROW1; // :empty
+  }
+  constexpr Iter begin() const { return Iter{ this, ROW0, COL0, ROW0, COL0 }; }
+  constexpr Iter end  () const { return Iter{ this, ROW1, COL0, ROW1, COL0 }; }
+  constexpr Elem rows () const { return ROW1 - ROW0; }
+  constexpr Elem cols () const { return ROW0 == ROW1 ? 0 : COL1 - COL0; }
+  constexpr Elem tiles() const { return ROW0 == ROW1 ? 0 : count( ROW0, ROW1, TR )*count( COL0, COL1, TC ); }
+  constexpr RANGE2D tile( Elem k ) const {
+    assert( k < tiles() );
+    const Elem n { count( COL0, COL1, TC ) };  // :tiles in a tile row
+    const Elem r0{ ROW0 + ( k / n )*TR     };
+    const Elem c0{ COL0 + ( k % n )*TC     };
+    return RANGE2D( RANGE< Elem >( r0, edge( r0, TR, ROW1 ) ), RANGE< Elem >( c0, edge( c0, TC, COL1 ) ), TR, TC );
+  }
+};//RANGE2D
+
 #endif // RANGE_H_INCLUDED
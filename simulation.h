@@ -0,0 +1,277 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Deterministic execution of logical processes: the calling thread drives all processes
+ as MEMBERS simulated members of the staff (discrete-event simulation) on virtual time
+ (see `VirtualClock` in `chronos.h`); `LogicalProcess::now()`, `Chronos`, `Timer` and
+ `pause` follow the virtual clock while Simulation exists.
+
+ Member that is free earliest takes the next step; ties between members and the choice
+ of the runnable process made by generator seeded by the caller. Step starts at the
+ member`s free time and takes virtual time spent in `pause` inside the step plus fixed
+ COST; process returns into the runnable set (or parks, or waits for its timer) when
+ the member becomes free. So the schedule is a function of the seed and the processes:
+ the same seed reproduces it bit by bit, `digest` summarizes it to compare runs.
+ Processes have to take randomness from seeded generators too (see `coherent.cpp`).
+
+ Steps of different members don`t overlap in real time: contention appears where
+ access is held across steps (coroutines holding Fluid, mailboxes) and on process
+ granularity. Processes, Fluids and mailboxes must be touched by the driving thread
+ only; Staff must not run at the same time.
+
+   Simulation simulation( P, seed, 4 );
+   simulation.run( log, Duration::Value{ 250.0 }[ MILLISEC ] );
+   simulation.info( log );
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef SIMULATION_H_INCLUDED
+#define SIMULATION_H_INCLUDED
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "chronos.h"
+#include "config.h"
+#include "logical.process.h"
+#include "logger.h"
+#include "timing.wheel.h"
+
+namespace CoreAGI {
+
+  class Simulation: public Dispatcher {
+  public:
+
+    using Timeout = TimerHandle;
+
+    struct Event {
+      double                             time;    // :virtual nanosec of the step start
+      unsigned                           member;
+      unsigned                           process; // :index in the set of processes
+      LogicalProcess::Statistics::RESULT result;
+    };
+
+  private:
+
+    struct Member {
+      double                     free;    // :virtual time the member finishes current step
+      const LogicalProcess*      holding; // :process of the current step
+      LogicalProcess::Statistics stat;
+      Member(): free{ 0 }, holding{ nullptr }, stat{}{}
+    };
+
+    struct Alarm {
+      const LogicalProcess*   process{ nullptr };
+      bool                    timeout{ false   }; // :withdraw parked process and mark it expired
+      std::function< void() > action {         }; // :executed instead if defined
+    };
+
+    static constexpr double INFINITE{ std::numeric_limits< double >::infinity() };
+    static constexpr double TICK    { 1000.0*Config::staff::WHEEL_TICK          }; // :nanosec
+
+    const uint64_t                                     SEED;
+    const unsigned                                     MEMBERS;
+    const double                                       COST;     // :virtual nanosec per step
+    std::mt19937_64                                    random;   // :sequence defined by the standard
+    std::unique_ptr< Member[] >                        member;
+    std::vector< const LogicalProcess* >               registry;
+    std::unordered_map< const LogicalProcess*, unsigned > index;
+    std::vector< const LogicalProcess* >               ready;    // :runnable processes
+    TimingWheel< Alarm >                               wheel;
+    uint64_t                                           tickets;
+    uint64_t                                           steps;
+    uint64_t                                           hash;     // :FNV-1a of events
+    bool                                               tracing;
+    std::vector< Event >                               trace;
+
+    static uint64_t tickOf( double t ){ return uint64_t( std::max( 0.0, t )/TICK ); }
+
+    unsigned draw( unsigned n ){ return unsigned( random() % n ); }
+
+    void digest( const Event& E ){
+      auto mix = [&]( uint64_t v ){
+        for( unsigned i = 0; i < 8; i++ ){ hash ^= ( v >> ( 8*i ) ) & 0xFF; hash *= 0x100000001B3ull; }
+      };
+      uint64_t t;
+      static_assert( sizeof( t ) == sizeof( E.time ) );
+      std::memcpy( &t, &E.time, sizeof( t ) );
+      mix( t ); mix( E.member ); mix( E.process ); mix( E.result );
+      if( tracing ) trace.push_back( E );
+    }
+
+    void fire(){
+                                                                                                                              /*
+      Execute timers due at current virtual time:
+                                                                                                                              */
+      std::vector< Alarm > fired;
+      wheel.advance( tickOf( VirtualClock::now() ), [&]( const Alarm& A ){ fired.push_back( A ); } );
+      for( auto& A: fired ){
+        if( A.action ) A.action();
+        else if( not A.timeout ) resume( A.process );
+        else if( A.process->withdraw() ){ A.process->expire(); resume( A.process ); } // :still parked
+      }
+    }
+
+    Timeout arm( double t, Alarm&& alarm ){
+      return wheel.schedule( uint64_t( std::ceil( std::max( 0.0, t )/TICK ) ), alarm );
+    }
+
+    void settle( const LogicalProcess* p ){
+                                                                                                                              /*
+      Member finished the step of `p`: park it, keep it in the wheel or return it into the
+      runnable set (see `StaffCore::Member::run`):
+                                                                                                                              */
+      if( p->blocked() ){ p->park(); return; }
+      const Timepoint t{ p->wakeup() };
+      if( t.nsec() > VirtualClock::now() ){ arm( t.nsec(), Alarm{ p, false, {} } ); return; }
+      ready.push_back( p );
+    }
+
+    unsigned earliest(){
+                                                                                                                              /*
+      Member that is free first; equally free members selected randomly:
+                                                                                                                              */
+      double   first{ INFINITE };
+      unsigned ties { 0        };
+      for( unsigned i = 0; i < MEMBERS; i++ ){
+        if( member[i].free <  first ){ first = member[i].free; ties = 1; }
+        else if( member[i].free == first ) ties++;
+      }
+      unsigned k{ ties > 1 ? draw( ties ) : 0 };
+      for( unsigned i = 0; i < MEMBERS; i++ ) if( member[i].free == first and k-- == 0 ) return i;
+      return 0;
+    }
+
+  public:
+
+    Simulation( const LogicalProcess** PROCESS, uint64_t seed, unsigned members = 1,
+                const Duration& cost = Duration::Value{ 1.0 }[ MICROSEC ] ):
+      SEED    { seed                                      },
+      MEMBERS { std::max( 1u, members )                   },
+      COST    { cost.endo()                               },
+      random  { seed                                      },
+      member  { std::make_unique< Member[] >( MEMBERS )   },
+      registry{                                           },
+      index   {                                           },
+      ready   {                                           },
+      wheel   { tickOf( VirtualClock::now() )             },
+      tickets { 0                                         },
+      steps   { 0                                         },
+      hash    { 0xCBF29CE484222325ull                     },
+      tracing { false                                     },
+      trace   {                                           }
+    {
+      VirtualClock::engage(); // :virtual time continues from the previous simulation if any
+      for( unsigned i = 0; i < MEMBERS; i++ ) member[i].free = VirtualClock::now();
+      for( unsigned i = 0; PROCESS[i]; i++ ){
+        index[ PROCESS[i] ] = registry.size();
+        registry.push_back( PROCESS[i] );
+        PROCESS[i]->assign( this );
+        ready.push_back( PROCESS[i] );
+      }
+    }
+
+    Simulation( const Simulation& )              = delete;
+    Simulation& operator = ( const Simulation& ) = delete;
+
+    void resume( const LogicalProcess* p ) override { ready.push_back( p ); }
+
+    uint64_t seed   () const { return SEED;  }
+    uint64_t digest () const { return hash;  } // :summary of the schedule
+    uint64_t count  () const { return steps; } // :number of steps executed
+
+    void                        record( bool on ){ tracing = on; }
+    const std::vector< Event >& events() const   { return trace; }
+
+    Timeout scheduleAt( const Timepoint& t, std::function< void() > action ){
+      return arm( t.nsec(), Alarm{ nullptr, false, std::move( action ) } );
+    }
+
+    Timeout timeout( const LogicalProcess* p, const Duration& d ){
+      return arm( VirtualClock::now() + d.endo(), Alarm{ p, true, {} } );
+    }
+
+    bool cancel( const Timeout& handle ){ return wheel.cancel( handle ); }
+
+    bool next( const Log& log ){
+                                                                                                                              /*
+      Execute one event: the earliest free member settles its finished step and takes the
+      next one. Returns `false` if nothing can happen anymore (all members idle, no timers):
+                                                                                                                              */
+      const unsigned m{ earliest() };
+      Member& M = member[m];
+      VirtualClock::set( M.free );
+      fire();
+      if( M.holding ){ settle( M.holding ); M.holding = nullptr; }
+      if( ready.empty() ){
+                                                                                                                              /*
+        Nothing to do: wait for the next step finished by other member or for the timer:
+                                                                                                                              */
+        const double now{ VirtualClock::now() };
+        double wake{ wheel.size() ? std::max( now, double( wheel.horizon() )*TICK ) : INFINITE };
+        for( unsigned i = 0; i < MEMBERS; i++ ) if( member[i].free > now ) wake = std::min( wake, member[i].free );
+        if( wake == INFINITE ) return false;
+        M.stat += LogicalProcess::Statistics::IDLE;
+        M.free  = wake;
+        return true;
+      }
+      const unsigned k{ draw( ready.size() ) };
+      const LogicalProcess* p = ready[k];
+      ready[k] = ready.back();
+      ready.pop_back();
+      const double start{ VirtualClock::now() };
+      const auto   result{ p->process( log ) };
+      M.stat += result;
+      if( p->schedule().timed() ) p->account( result, tickets++ );
+      steps++;
+      digest( Event{ start, m, index[p], result } );
+      M.free    = VirtualClock::now() + COST;
+      M.holding = p;
+      return true;
+    }
+
+    uint64_t run( const Log& log, const Duration& span ){
+                                                                                                                              /*
+      Run for `span` of virtual time; returns number of executed steps:
+                                                                                                                              */
+      const uint64_t before{ steps };
+      const double   end   { VirtualClock::now() + span.endo() };
+      while( VirtualClock::now() < end and next( log ) );
+      return steps - before;
+    }
+
+    void info( const Log& log ) const {
+      log.vital( kit( "Simulation: seed %llu, %u members, %llu steps, virtual time %.3f ms, digest %016llx",
+                      (unsigned long long) SEED, MEMBERS, (unsigned long long) steps, 1.0e-6*VirtualClock::now(),
+                      (unsigned long long) hash ) );
+      for( unsigned i = 0; i < MEMBERS; i++ ){
+        member[i].stat.expose( log, kit( "Simulated member %u statistics:", i ).c_str() );
+      }
+    }
+
+   ~Simulation(){
+      for( auto p: registry ) p->assign( nullptr ); // :processes still parked are not resumed
+      VirtualClock::disengage();
+    }
+
+  };//Simulation
+
+}//namespace CoreAGI
+
+#endif // SIMULATION_H_INCLUDED
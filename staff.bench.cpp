@@ -0,0 +1,190 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Scaling benchmark for `Staff`: the same set of fine-grained logical processes
+ executed by 1, 2, 4 .. 64 working threads; throughput measured as number of
+ successfully executed steps per second.
+
+ Usage: staff.bench [ processes [ duration, millisec [ step cost, iterations [ placement [ quantum ] ] ] ] ]
+
+ where placement is one of `none`, `compact`, `spread`, `core` (see `topology.h`)
+ and quantum is the max number of consecutive steps per occupation of the process.
+
+ Mixed latency case: the same processes plus one that sleeps SLOW_STEP millisec per
+ step; fast processes sharing a member with the slow one must not starve, so the
+ least served fast process is reported relative to the mean one.
+
+ 2026.10.18  Initial version
+
+ 2026.10.18  Execution quantum argument
+
+ 2026.10.18  Mixed latency case
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <memory>
+#include <vector>
+
+#include "logger.global.h"
+#include "logical.process.h"
+#include "staff.h"
+#include "timer.h"
+
+namespace CoreAGI {
+                                                                                                                              /*
+  Logical process with private state that occupies a few cache lines:
+                                                                                                                              */
+  class Spinner {
+
+    static constexpr unsigned SIZE{ 32 };
+
+    uint64_t state[ SIZE ];
+    unsigned cost;
+
+  public:
+
+    Spinner( unsigned seed, unsigned cost ): state{}, cost{ cost }{
+      for( unsigned i = 0; i < SIZE; i++ ) state[i] = seed*2654435761u + i + 1;
+    }
+
+    bool operator()( [[maybe_unused]] const Log& log ){
+      for( unsigned i = 0; i < cost; i++ ){ // :xorshift over private state
+        uint64_t& x = state[ i % SIZE ];
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+      }
+      return true;
+    }
+
+  };//Spinner
+
+  struct Result {
+    double rate;  // :steps per second
+    double done;  // :fraction of DONE among all process() calls
+  };
+
+  template< unsigned STAFF > Result measure( unsigned N, unsigned duration, unsigned cost, Placement placement, unsigned quantum ){
+                                                                                                                              /*
+    Fresh processes for each measurement:
+                                                                                                                              */
+    std::vector< Spinner >                           S;
+    std::vector< std::unique_ptr< LogicalProcess > > L;
+    std::vector< const LogicalProcess* >             P;
+    S.reserve( N );
+    for( unsigned i = 0; i < N; i++ ) S.emplace_back( i, cost );
+    for( unsigned i = 0; i < N; i++ ){
+      L.emplace_back( std::make_unique< LogicalProcess >( "S", [&S,i]( const Log& log )->bool{ return S[i]( log ); } ) );
+      L.back()->quantum( { quantum, {} } );
+      P.push_back( L.back().get() );
+    }
+    P.push_back( nullptr );
+
+    Staff< STAFF > staff( P.data() );
+    staff.place( placement );
+    for( auto& p: L ) p->start();
+    Timer timer;
+    staff.start();
+    pause{ duration }[ MILLISEC ];
+    staff.stop();
+    const double elapsed{ timer.stop().sec() };
+
+    double done{ 0 }, total{ 0 };
+    for( auto& p: L ){
+      const auto& stat = p->statistics();
+      using R = LogicalProcess::Statistics;
+      done  += stat[ R::DONE ];
+      total += stat[ R::IDLE ] + stat[ R::BUSY ] + stat[ R::DONE ] + stat[ R::FAIL ];
+    }
+    return Result{ done/elapsed, total > 0 ? done/total : 0.0 };
+  }
+
+  struct Mixed {
+    double rate;  // :steps of fast processes per second
+    double least; // :min steps of a fast process relative to the mean
+  };
+
+  template< unsigned STAFF > Mixed mixed( unsigned N, unsigned duration, unsigned cost ){
+                                                                                                                              /*
+    N fast processes and a slow one (sleeps in every step, i.e. holds its member):
+                                                                                                                              */
+    static constexpr unsigned SLOW_STEP{ 20 }; // :millisec
+    std::vector< Spinner >                           S;
+    std::vector< std::unique_ptr< LogicalProcess > > L;
+    std::vector< const LogicalProcess* >             P;
+    S.reserve( N );
+    for( unsigned i = 0; i < N; i++ ) S.emplace_back( i, cost );
+    for( unsigned i = 0; i < N; i++ ){
+      L.emplace_back( std::make_unique< LogicalProcess >( "S", [&S,i]( const Log& log )->bool{ return S[i]( log ); } ) );
+      P.push_back( L.back().get() );
+    }
+    LogicalProcess slow( "slow", []( const Log& )->bool{ pause{ SLOW_STEP }[ MILLISEC ]; return true; } );
+    P.push_back( &slow );
+    P.push_back( nullptr );
+
+    Staff< STAFF > staff( P.data() );
+    for( auto& p: L ) p->start();
+    slow.start();
+    Timer timer;
+    staff.start();
+    pause{ duration }[ MILLISEC ];
+    staff.stop();
+    const double elapsed{ timer.stop().sec() };
+
+    double done{ 0 }, least{ -1 };
+    for( auto& p: L ){
+      const double d( p->statistics()[ LogicalProcess::Statistics::DONE ] );
+      done += d;
+      if( least < 0 or d < least ) least = d;
+    }
+    return Mixed{ done/elapsed, done > 0 ? least*N/done : 0.0 };
+  }
+
+}//namespace CoreAGI
+
+
+int main( int argc, char* argv[] ){
+
+  using namespace CoreAGI;
+
+  const unsigned N       { argc > 1 ? unsigned( atoi( argv[1] ) ) : 256u };
+  const unsigned DURATION{ argc > 2 ? unsigned( atoi( argv[2] ) ) : 250u };
+  const unsigned COST    { argc > 3 ? unsigned( atoi( argv[3] ) ) : 200u };
+  Placement      PLACEMENT{ Placement::NONE };
+  if( argc > 4 ) for( auto p: { Placement::COMPACT, Placement::SPREAD, Placement::CORE } ) if( strcmp( argv[4], lex( p ) ) == 0 ) PLACEMENT = p;
+  const unsigned QUANTUM { argc > 5 ? unsigned( atoi( argv[5] ) ) : 1u };
+
+  auto log = logger.log( "bench" );
+  log.vital( kit( "%u logical processes, %u millisec per point, step cost %u, %u hardware threads, placement %s, quantum %u",
+                  N, DURATION, COST, std::thread::hardware_concurrency(), lex( PLACEMENT ), QUANTUM ) );
+
+  double base{ 0.0 };
+  auto row = [&]( unsigned staff, const Result& R ){
+    if( staff == 1 ) base = R.rate;
+    log.vital( kit( "  %3u workers  %12.0f steps/sec  speedup %6.2f  efficiency %6.2f %%  done %6.2f %%",
+                    staff, R.rate, R.rate/base, 100.0*R.rate/base/staff, 100.0*R.done ) );
+  };
+  log.vital( "Staff scaling:" );
+  row(  1, measure<  1 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row(  2, measure<  2 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row(  4, measure<  4 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row(  8, measure<  8 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row( 16, measure< 16 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row( 32, measure< 32 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+  row( 64, measure< 64 >( N, DURATION, COST, PLACEMENT, QUANTUM ) );
+
+  auto mix = [&]( unsigned staff, unsigned n, const Mixed& R ){
+    log.vital( kit( "  %3u workers  %3u fast  %12.0f steps/sec  least served %6.2f %% of mean",
+                    staff, n, R.rate, 100.0*R.least ) );
+  };
+  log.vital( "Mixed latency (one process sleeps in every step):" );
+  mix( 2, 2, mixed< 2 >( 2, DURATION, COST ) );
+  mix( 2, N, mixed< 2 >( N, DURATION, COST ) );
+  mix( 4, N, mixed< 4 >( N, DURATION, COST ) );
+  log.flush();
+
+  CoreAGI::pause( 100 )[ MILLISEC ];
+
+  return 0;
+}
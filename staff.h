@@ -10,55 +10,261 @@
 
  2023.05.04  Initial version
 
+ 2026.10.18  Each member owns work-stealing deque of logical processes (see `deque.h`):
+             member takes process from own deque first and steals from random victim
+             when own deque is empty or every REBALANCE_PERIOD iterations (so process
+             queued behind a long step moves to another member); executed process
+             returns into own deque.
+             Number of members no more limited by 26.
+
+ 2026.10.18  Implementation moved into non-template `StaffCore` with number of members
+             defined at run time; `Staff< STAFF >` keeps fixed number of members.
+             Added `ElasticStaff` that starts with number of members matched CPU quota
+             (see `cpu.h`) and engages/disengages members between bounds following
+             measured utilization.
+
+ 2026.10.18  Members can be pinned to CPU according to placement policy (see `topology.h`).
+
+ 2026.10.18  Dispatch policy: STEALING (default) or DEADLINE - earliest-deadline-first
+             over released steps with priority fallback (see `LogicalProcess::Schedule`).
+
+ 2026.10.18  Process blocked on a Fluid parked on its wait-list instead of being retried;
+             Staff resumes it through the injection queue (or agenda) when woken up.
+
+ 2026.10.18  Steps timed by processes themselves; release times and deadlines use the common
+             clock `LogicalProcess::now()`.
+
+ 2026.10.18  Processes registry: processes can be added, removed or replaced while Staff runs.
+             Retired process leaves the runnable set and is handed back to the owner only
+             when no member can hold it (epoch-based reclamation).
+
+ 2026.10.18  Timers: hierarchical timing wheel (see `timing.wheel.h`) keeps postponed and periodic
+             processes off the runnable set until due; one-shot actions and timeouts of parked
+             processes can be scheduled and cancelled. Idle member dozes until the next timer,
+             new runnable process or IDLE_DOZE limit instead of spinning.
+
+ 2026.10.18  Members and processes can be surveyed by observers (see `staff.telemetry.h`).
+
+ 2026.10.18  Every member exposes the step it executes (see `LogicalProcess::Occupancy`) to
+             the step watchdog (see `watchdog.h`).
+
+ 2026.10.18  Locality (STEALING dispatch): resumed process returns to the member that executed
+             it last; process that accesses the same Fluid in consecutive steps moves to the
+             member the Fluid`s users gathered on, unless that member is busier. Otherwise
+             processes change members only by stealing, i.e. to rebalance load.
+             Resumed process returns to its member only if that member can take it at once,
+             otherwise it goes to the shared inbox. Switched by `Config::staff::LOCALITY`
+             (on by default) and `locality( bool )`; `affinity.bench` compares both modes.
+
+ 2026.10.18  Fork-join tasks (see `fork.join.h`): members execute tasks spawned by steps before
+             taking the next process and don`t doze while tasks are queued.
+
+ 2026.10.18  Every member owns scratch arena (see `arena.h`) reset after each occupation of a process.
+
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef STAFF_H_INCLUDED
 #define STAFF_H_INCLUDED
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <thread>
 #include <string>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
+#include "arena.h"
+#include "config.h"
+#include "cpu.h"
+#include "deque.h"
+#include "fork.join.h"
 #include "logical.process.h"
 #include "logger.h"
+#include "timer.h"
+#include "timing.wheel.h"
+#include "topology.h"
 
 namespace CoreAGI{
 
-  template< unsigned STAFF > class Staff {
+  enum class Dispatch {
+    STEALING, // :per-member deques with work stealing
+    DEADLINE  // :shared agenda, earliest deadline first, then highest priority
+  };
+
+  class StaffCore: public Dispatcher {
+  public:
+
+    using Deque   = CoreAGI::Deque< const LogicalProcess*, Config::staff::DEQUE_CAPACITY >;
+    using Timeout = TimerHandle; // :handle of scheduled timer
+                                                                                                                              /*
+    Member names are `A`..`Z`, then `A1`..`Z1` and so on:
+                                                                                                                              */
+    static std::string nameOf( unsigned i ){
+      constexpr const char* SEQ{ "ABCDEFGHIJKLMNOPQRSTUVWXYZ" };
+      constexpr unsigned    LEN{ 26 };
+      std::string name( 1, SEQ[ i % LEN ] );
+      if( i >= LEN ) name += std::to_string( i / LEN );
+      return name;
+    }
+
+  protected:
 
     struct Member {
 
       std::string                name;
-      const LogicalProcess**     P;
+      StaffCore*                 staff;
+      unsigned                   index;  // :own index in the staff
+      Deque                      deque;  // :processes ready to be executed by this member
       std::thread                thread;
+      int                        cpu;    // :CPU the member pinned to, -1 if not pinned
       std::atomic< bool >        terminate;
       std::atomic< bool >        terminated;
-      LogicalProcess::Statistics stat;
+      LogicalProcess::Statistics stat;   // :IDLE also counts attempts that found no process
+      alignas( 64 )
+      std::atomic< uint64_t >    epoch;  // :staff epoch seen at the start of current iteration, 0 if not running
+      std::atomic< uint64_t >    dozed;  // :total doze time, nanosec
+      alignas( 64 )
+      LogicalProcess::Occupancy  occupancy; // :step executed now (see `watchdog.h`)
+      alignas( 64 )
+      std::mutex                          transfer; // :protects `incoming`
+      std::deque< const LogicalProcess* > incoming; // :processes delivered by other threads (see `StaffCore::deliver`)
+      std::atomic< unsigned >             arrivals; // :size of `incoming`, checked without lock
+      Arena                               arena;    // :scratch memory of steps (see `arena.h`)
+      ArenaResource                       resource;
 
-      void run(){
+      const LogicalProcess* receive(){
+        if( arrivals.load( std::memory_order_relaxed ) == 0 ) return nullptr;
+        std::lock_guard< std::mutex > lock( transfer );
+        if( incoming.empty() ) return nullptr;
+        const LogicalProcess* p = incoming.front();
+        incoming.pop_front();
+        arrivals.store( incoming.size() );
+        return p;
+      }
+
+      const LogicalProcess* take( std::mt19937& random, bool rebalance ){
                                                                                                                               /*
-        Calculate number of logical processes:
+        Processes delivered to this member and resumed ones first (they have waited already),
+        then own deque, then try to steal oldest process (or delivered one) of randomly
+        selected member.
+        Own deque served in FIFO order (from the `top` end): executed process pushed back
+        to the `bottom`, so own processes are executed round-robin and don`t starve.
+        Deques of disengaged members are victims too, so their processes are not lost.
+        Every REBALANCE_PERIOD iterations (`rebalance`) the member tries to steal before
+        serving own deque: otherwise process queued behind a long step of another member
+        waits for it while members with own work never steal:
                                                                                                                               */
-        unsigned N{ 0 };
-        while( P[N] ) N++;
+        const LogicalProcess* p = receive();
+        if( p ) return p;
+        p = staff->injected.load( std::memory_order_relaxed ) ? staff->extract() : nullptr;
+        if( p ) return p;
+        const unsigned M = staff->UPPER;
+        std::uniform_int_distribution< unsigned > uniform( 0, M > 1 ? M - 2 : 0 );
+        if( rebalance and M > 1 ){
+          unsigned victim = uniform( random );
+          if( victim >= index ) victim++; // :skip himself
+          if( ( p = staff->member[ victim ].deque.steal() ) ){
+            staff->stolen.fetch_add( 1, std::memory_order_relaxed );
+            return p;
+          }
+        }
+        p = deque.steal();
+        if( p or M == 1 ) return p;
+        for( unsigned attempt = 0; attempt < Config::staff::STEAL_ATTEMPTS; attempt++ ){
+          unsigned victim = uniform( random );
+          if( victim >= index ) victim++; // :skip himself
+          if( ( p = staff->member[ victim ].deque.steal() ) or ( p = staff->member[ victim ].receive() ) ){
+            staff->stolen.fetch_add( 1, std::memory_order_relaxed );
+            return p;
+          }
+        }
+        return nullptr;
+      }
+
+      void run(){
+        const unsigned N{ staff->processes() };
 
         std::random_device RANDOM_DEVICE;
         std::mt19937 RANDOM( RANDOM_DEVICE() );
-        std::uniform_int_distribution< int > uniform( 0, N-1 );
                                                                                                                               /*
         Open log:
                                                                                                                               */
         auto log = logger.log( name ); // :create log
         log.vital( kit( "Staff::Member started, %i branches", N ) );
+        LogicalProcess::occupy( &occupancy );
+        staff->tasks.enter( index );
+        LogicalProcess::Statistics::attach( index );
+        ArenaResource::enter( &resource );
                                                                                                                               /*
-        Mark himself as running:
+        Bind to CPU and report resulting placement:
                                                                                                                               */
-        terminated.store( false );
+        if( cpu >= 0 ){
+          if( pin( pthread_self(), cpu ) ){
+            const Topology::CPU* c = staff->topology.find( cpu );
+            if( c ) log.vital( kit( "Staff::Member pinned to CPU %i: package %i, core %i, SMT %i, L2 %i, L3 %i",
+                                    cpu, c->package, c->core, c->smt, c->L2, c->L3 ) );
+            else    log.vital( kit( "Staff::Member pinned to CPU %i", cpu ) );
+          } else {
+            log.vital( kit( "Staff::Member can`t be pinned to CPU %i", cpu ) );
+          }
+        }
                                                                                                                               /*
-        Main loop:
+        Main loop; the taken process belongs to this member only until it is pushed back:
                                                                                                                               */
-        while( not terminate.load() ) stat += P[ uniform( RANDOM ) ]->process( log );
+        const bool DEADLINE{ staff->DISPATCH == Dispatch::DEADLINE };
+        unsigned   iteration{ 0 };
+        unsigned   idle     { 0 }; // :successive iterations without work (no process or inactive one)
+        while( not terminate.load() ){
+          if( idle >= Config::staff::IDLE_SPINS ){
+            idle = 0;
+            epoch.store( 0 ); // :holds no process while dozing
+            const Timepoint t0{ LogicalProcess::now() };
+            staff->doze( *this );
+            dozed.fetch_add( uint64_t( ( LogicalProcess::now() - t0 ).endo() ), std::memory_order_relaxed );
+          }
+          epoch.store( staff->epoch.load() ); // :processes retired before this point can`t be taken
+          if( ++iteration % Config::staff::WHEEL_POLL == 0 ){ // :busy members poll timers and reclaim retirees too
+            staff->tick();
+            if( staff->limbo.load( std::memory_order_relaxed ) ) staff->collect();
+          }
+          if( staff->tasks.help() ){ idle = 0; continue; } // :tasks speed up steps waiting for them
+          const LogicalProcess* p = DEADLINE ? staff->earliest() : take( RANDOM, iteration % Config::staff::REBALANCE_PERIOD == 0 );
+          if( not p ){
+            stat += LogicalProcess::Statistics::IDLE;
+            if( staff->limbo.load( std::memory_order_relaxed ) ) staff->collect();
+            staff->tick();
+            idle++;
+            std::this_thread::yield();
+            continue;
+          }
+          if( p->retiring() ){ staff->dismiss( p ); continue; }
+          FluidCore::touched = nullptr;
+          const auto result{ p->process( log ) };
+          arena.reset(); // :scratch memory of the steps
+          stat += result;
+          unsigned target{ index };
+          if( not DEADLINE and result == LogicalProcess::Statistics::DONE ) target = staff->colocate( p, index );
+          p->placement().member.store( int( index ), std::memory_order_relaxed );
+          if( DEADLINE or p->schedule().timed() ) p->account( result, staff->tickets++ );
+          idle = result == LogicalProcess::Statistics::IDLE ? idle + 1 : 0;
+          if( p->blocked() ){ if( not p->park() ) staff->dismiss( p ); } // :don`t touch `p` after parking
+          else if( p->retiring() ) staff->dismiss( p );
+          else if( staff->defer( p ) ) continue; // :kept by the timing wheel until due
+          else if( DEADLINE ) staff->enlist( p );
+          else if( target != index ) staff->deliver( target, p );
+          else while( not deque.push( p ) ){ // :own deque full: the oldest process moves to the shared inbox
+            if( const LogicalProcess* q = deque.steal() ) staff->circulate( q );
+          }
+        }
                                                                                                                               /*
         Print statistics:
                                                                                                                               */
@@ -66,14 +272,26 @@ namespace CoreAGI{
                                                                                                                               /*
         Mark himself as terminated:
                                                                                                                               */
+        staff->tasks.leave();
+        LogicalProcess::Statistics::detach();
+        ArenaResource::enter( nullptr );
+        LogicalProcess::occupy( nullptr );
+        epoch.store( 0 );
         terminated.store( true );
       }
 
-      Member(): name{}, P{}, thread{}, terminate{ false }, terminated{ true }, stat{}{}
+      Member(): name{}, staff{}, index{}, deque{}, thread{}, cpu{ -1 }, terminate{ false }, terminated{ true }, stat{}, epoch{ 0 }, dozed{ 0 }, occupancy{},
+                transfer{}, incoming{}, arrivals{ 0 }, arena{}, resource{ arena }{}
+
+      bool live () const { return not terminated.load(); }
+      void stop ()       { terminate.store( true );      }
 
-      bool live () const { return not terminated.load();               }
-      void start()       { thread = std::thread( &Member::run, this ); }
-      void stop ()       { terminate.store( true );                    }
+      void start(){
+        if( thread.joinable() ) thread.join(); // :restart of previously disengaged member
+        terminate .store( false );
+        terminated.store( false ); // :mark as running
+        thread = std::thread( &Member::run, this );
+      }
 
      ~Member(){
         terminate.store( true );
@@ -83,41 +301,703 @@ namespace CoreAGI{
 
     };//Member
 
-    const LogicalProcess** P;
+    const unsigned              LOWER;    // :min number of engaged members
+    const unsigned              UPPER;    // :max number of engaged members
+    std::unique_ptr< Member[] > member;   // :UPPER members; [ 0, engaged ) are running
+    std::atomic< unsigned >     engaged;  // :number of running members
+    const unsigned              INITIAL;  // :number of members engaged at start
+    Topology                    topology;
+    const Dispatch              DISPATCH;
+    std::atomic< uint64_t >     tickets;  // :FIFO order of equal deadlines and priorities
+                                                                                                                              /*
+    Agenda of DEADLINE dispatch: binary heaps of released (ordered by deadline, then by
+    priority) and not yet released (ordered by release time) processes:
+                                                                                                                              */
+    std::mutex                            agenda;
+    std::vector< const LogicalProcess* >  ready;
+    std::vector< const LogicalProcess* >  pending;
+
+                                                                                                                              /*
+    Processes resumed after parking (STEALING dispatch); any thread pushes, members pull:
+                                                                                                                              */
+    std::mutex                            injection;
+    std::deque< const LogicalProcess* >   inbox;
+    std::atomic< unsigned >               injected; // :size of `inbox`, checked without lock
+                                                                                                                              /*
+    Locality of STEALING dispatch:
+                                                                                                                              */
+    std::atomic< bool >                   affine;   // :soft affinity and co-location enabled
+    std::atomic< uint64_t >               migrated; // :processes moved to co-locate with Fluid users
+    std::atomic< uint64_t >               stolen;   // :processes taken from other members
+                                                                                                                              /*
+    Registry of processes. Removal is asynchronous: process marked as retiring leaves the
+    runnable set when a member takes it (or withdrawn from the Fluid it parked on), then
+    waits in `retirees` until every running member starts the next iteration (epoch of the
+    member not less than epoch of retirement) and then handed to `reclaim` callback:
+                                                                                                                              */
+    struct Retiree {
+      const LogicalProcess*                          process;
+      uint64_t                                       epoch;   // :0 while process still in the runnable set
+      std::function< void( const LogicalProcess* ) > reclaim;
+    };
+
+    std::mutex                            registration; // :protects `registry` and `retirees`
+    std::vector< const LogicalProcess* >  registry;
+    std::vector< Retiree >                retirees;
+    std::atomic< unsigned >               population;   // :size of `registry`
+    std::atomic< unsigned >               limbo;        // :number of retirees left the runnable set
+    std::atomic< uint64_t >               epoch;
+    bool                                  circulating;  // :DEADLINE agenda filled
+                                                                                                                              /*
+    Timers: postponed processes (STEALING dispatch), one-shot actions and timeouts of
+    parked processes; wheel advanced by members (who gets the lock) and fired timers
+    executed outside of the lock:
+                                                                                                                              */
+    struct Alarm {
+      const LogicalProcess*   process{ nullptr };
+      bool                    timeout{ false   }; // :withdraw parked process and mark it expired
+      std::function< void() > action {         }; // :executed instead if defined
+    };
 
-    Member member[ STAFF ];
+    using Wheel = TimingWheel< Alarm >;
 
-  public:
+    static constexpr uint64_t NEVER{ std::numeric_limits< uint64_t >::max() };
+    static constexpr double   TICK { 1000.0*Config::staff::WHEEL_TICK       }; // :nanosec
 
-    Staff( const LogicalProcess** PROCESS ): P{ PROCESS }, member{}{
-      constexpr const char* SEQ{ "ABCDEFGHIJKLMNOPQRSTUVWXYZ" }; static_assert( STAFF < strlen( SEQ ) );
-      char name[2]{ ' ', '\0' };
-      for( unsigned i = 0; i < STAFF; i++ ){
-        name  [0]      = SEQ[i];
-        member[i].name = std::string( name );
-        member[i].P    = P;
+    std::mutex                            timing;
+    Wheel                                 wheel;
+    std::atomic< uint64_t >               horizon;      // :no timer due before this tick
+    std::atomic< unsigned >               timers;       // :size of `wheel`, checked without lock
+    std::unordered_map< const LogicalProcess*, std::vector< Timeout > > guards; // :timeouts of processes, cancelled at dismissal
+                                                                                                                              /*
+    Idle members doze on `bell`; rung when a process becomes runnable or timer scheduled:
+                                                                                                                              */
+    std::mutex                            dozing;
+    std::condition_variable               bell;
+    std::atomic< unsigned >               sleepers;
+                                                                                                                              /*
+    Fork-join tasks executed by members (see `fork.join.h`):
+                                                                                                                              */
+    TaskPool                              tasks;
+
+    static uint64_t tickOf( const Timepoint& t ){ return uint64_t( std::max( 0.0, t.nsec() )/TICK ); }
+
+    void ring(){
+      if( sleepers.load() == 0 ) return;
+      std::lock_guard< std::mutex > lock( dozing ); // :sleeper is either waiting already or not checked yet
+      bell.notify_one();
+    }
+
+    Timeout arm( const Timepoint& t, Alarm&& alarm ){
+      const uint64_t due{ uint64_t( std::ceil( std::max( 0.0, t.nsec() )/TICK ) ) };
+      Timeout handle;
+      {
+        std::lock_guard< std::mutex > lock( timing );
+        handle = wheel.schedule( due, alarm );
+        timers.store( wheel.size() );
+        if( alarm.timeout ){ // :handles of fired and cancelled timeouts dropped
+          auto& G = guards[ alarm.process ];
+          std::erase_if( G, [&]( const Timeout& h ){ return not wheel.pending( h ); } );
+          G.push_back( handle );
+        }
+        horizon.store( std::min( horizon.load(), std::max( due, wheel.tick() + 1 ) ) );
+      }
+      ring(); // :dozing member has to recalculate its doze
+      return handle;
+    }
+
+    void tick(){
+                                                                                                                              /*
+      Advance the wheel up to the current time and fire due timers; skipped if another
+      member advances it right now:
+                                                                                                                              */
+      if( timers.load( std::memory_order_relaxed ) == 0 ) return;
+      const uint64_t now{ tickOf( LogicalProcess::now() ) };
+      if( now < horizon.load( std::memory_order_relaxed ) ) return;
+      static thread_local std::vector< Alarm > fired;
+      fired.clear();
+      {
+        std::unique_lock< std::mutex > lock( timing, std::try_to_lock );
+        if( not lock.owns_lock() ) return;
+        wheel.advance( now, [&]( const Alarm& A ){ fired.push_back( A ); } );
+        timers .store( wheel.size()    );
+        horizon.store( wheel.horizon() );
+      }
+      for( auto& A: fired ){
+        if( A.action ) A.action();
+        else if( not A.timeout ) resume( A.process );
+        else if( A.process->withdraw() ){ A.process->expire(); resume( A.process ); } // :still parked
+      }
+    }
+
+    bool defer( const LogicalProcess* p ){
+                                                                                                                              /*
+      Process executed its step; next one postponed by the step (see `LogicalProcess::scheduleAt`)
+      or by the period: DEADLINE agenda keeps it as pending, otherwise it goes into the wheel:
+                                                                                                                              */
+      const Timepoint t{ p->wakeup() };
+      if( t.nsec() <= 0 ) return false;
+      if( DISPATCH == Dispatch::DEADLINE ){
+        if( t > p->release() ) p->release( t, tickets++ );
+        return false;
+      }
+      if( t <= LogicalProcess::now() ) return false;
+      arm( t, Alarm{ p, false, {} } );
+      return true;
+    }
+
+    void doze( const Member& M ){
+                                                                                                                              /*
+      Sleep until ringed, the next timer or pending DEADLINE release, but not longer than
+      IDLE_DOZE: some events (process started, pushed into deque of running member) don`t
+      ring, and deques and agenda keep inactive processes too. Member doesn`t doze while
+      processes delivered to it wait:
+                                                                                                                              */
+      std::unique_lock< std::mutex > lock( dozing );
+      sleepers++;
+      if( not M.terminate.load() and M.arrivals.load() == 0 and injected.load() == 0 and tasks.pending() == 0 ){
+        const Timepoint now{ LogicalProcess::now() };
+        double limit{ 1000.0*Config::staff::IDLE_DOZE }; // :nanosec
+        const uint64_t h{ horizon.load() };
+        if( h != NEVER ) limit = std::min( limit, double( h )*TICK - now.nsec() );
+        if( DISPATCH == Dispatch::DEADLINE ){
+          std::lock_guard< std::mutex > guard( agenda );
+          if( not pending.empty() ) limit = std::min( limit, ( pending.front()->release() - now ).nsec() );
+        }
+        if( limit > 0 ) bell.wait_for( lock, std::chrono::nanoseconds( int64_t( limit ) ) );
+      }
+      sleepers--;
+    }
+
+    void circulate( const LogicalProcess* p ){
+                                                                                                                              /*
+      Put new process into the runnable set:
+                                                                                                                              */
+      if( DISPATCH == Dispatch::DEADLINE ){ p->release( LogicalProcess::now(), tickets++ ); enlist( p ); return; }
+      {
+        std::lock_guard< std::mutex > lock( injection );
+        inbox.push_back( p );
+        injected.store( inbox.size() );
+      }
+      ring();
+    }
+
+    void deliver( unsigned m, const LogicalProcess* p ){
+                                                                                                                              /*
+      Hand process to the member `m` (any thread):
+                                                                                                                              */
+      Member& M = member[m];
+      {
+        std::lock_guard< std::mutex > lock( M.transfer );
+        M.incoming.push_back( p );
+        M.arrivals.store( M.incoming.size() );
+      }
+      if( sleepers.load() == 0 ) return;
+      std::lock_guard< std::mutex > lock( dozing ); // :addressee may doze, so all sleepers rung
+      bell.notify_all();
+    }
+
+    bool receptive( unsigned m ) const {
+                                                                                                                              /*
+      Member can take delivered process soon: running (not dozing), not executing a step
+      (odd serial of the occupancy) and without other deliveries waiting:
+                                                                                                                              */
+      if( m >= engaged.load() ) return false;
+      const Member& M = member[m];
+      return M.epoch   .load( std::memory_order_relaxed ) != 0
+         and ( M.occupancy.serial.load( std::memory_order_relaxed ) & 1 ) == 0
+         and M.arrivals.load( std::memory_order_relaxed ) == 0;
+    }
+
+    unsigned colocate( const LogicalProcess* p, unsigned m ){
+                                                                                                                              /*
+      Called by member `m` after DONE step of `p`: member the process should go to. Process
+      that accessed the same Fluid in COLOCATE_STREAK consecutive steps goes to the Fluid`s
+      home member (member becomes the home if there is no one) unless the home member has
+      more than COLOCATE_SLACK processes queued above own queue of `m`:
+                                                                                                                              */
+      if( not affine.load( std::memory_order_relaxed ) ) return m;
+      LogicalProcess::Locality& L = p->placement();
+      const FluidCore* f{ FluidCore::touched };
+      if( not f ){ L.streak = 0; return m; }
+      if( f != L.resource ){ L.resource = f; L.streak = 1; return m; }
+      if( ++L.streak < Config::staff::COLOCATE_STREAK ) return m;
+      const int h{ f->home.load( std::memory_order_relaxed ) };
+      if( h < 0 or unsigned( h ) >= engaged.load( std::memory_order_relaxed ) ){ f->home.store( int( m ), std::memory_order_relaxed ); return m; }
+      if( unsigned( h ) == m ) return m;
+      const Member& H = member[h];
+      if( H.deque.size() + H.arrivals.load( std::memory_order_relaxed ) > member[m].deque.size() + Config::staff::COLOCATE_SLACK ) return m;
+      L.streak = 0;
+      migrated.fetch_add( 1, std::memory_order_relaxed );
+      return unsigned( h );
+    }
+
+    void dismiss( const LogicalProcess* p ){
+                                                                                                                              /*
+      Called by the member that took retiring process out of the runnable set (or by `remove`
+      for parked one). Pending timeouts of the process cancelled: the process can be reclaimed
+      (destroyed) before they fire. Timeout fired already but not executed yet is harmless:
+      member that executes it started its iteration before the dismissal, so the process
+      is not reclaimed until the member`s next iteration:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( timing );
+        const auto G = guards.find( p );
+        if( G != guards.end() ){
+          for( const auto& h: G->second ) wheel.cancel( h );
+          guards.erase( G );
+          timers.store( wheel.size() );
+        }
+      }
+      p->assign( nullptr );
+      std::lock_guard< std::mutex > lock( registration );
+      for( auto& R: retirees ) if( R.process == p and R.epoch == 0 ){ R.epoch = ++epoch; limbo++; break; }
+    }
+
+    const LogicalProcess* extract(){
+      std::lock_guard< std::mutex > lock( injection );
+      if( inbox.empty() ) return nullptr;
+      const LogicalProcess* p = inbox.front();
+      inbox.pop_front();
+      injected.store( inbox.size() );
+      return p;
+    }
+
+    static bool later( const LogicalProcess* a, const LogicalProcess* b ){
+      if( a->deadline() != b->deadline() ) return a->deadline() > b->deadline();
+      if( a->priority() != b->priority() ) return a->priority() < b->priority();
+      return a->order() > b->order();
+    }
+
+    static bool postponed( const LogicalProcess* a, const LogicalProcess* b ){
+      return a->release() > b->release();
+    }
+
+    void enlist( const LogicalProcess* p ){
+      {
+        std::lock_guard< std::mutex > lock( agenda );
+        if( p->release() > LogicalProcess::now() ){
+          pending.push_back( p ); std::push_heap( pending.begin(), pending.end(), postponed );
+        } else {
+          ready  .push_back( p ); std::push_heap( ready  .begin(), ready  .end(), later     );
+        }
+      }
+      ring();
+    }
+
+    const LogicalProcess* earliest(){
+                                                                                                                              /*
+      Move released processes into `ready` heap and take the most urgent one:
+                                                                                                                              */
+      std::lock_guard< std::mutex > lock( agenda );
+      const Timepoint now{ LogicalProcess::now() };
+      while( not pending.empty() and pending.front()->release() <= now ){
+        std::pop_heap( pending.begin(), pending.end(), postponed );
+        pending.back()->ready( pending.back()->release() ); // :runnable since release, not since enlisted
+        ready.push_back( pending.back() ); pending.pop_back();
+        std::push_heap( ready.begin(), ready.end(), later );
+      }
+      if( ready.empty() ) return nullptr;
+      std::pop_heap( ready.begin(), ready.end(), later );
+      const LogicalProcess* p = ready.back();
+      ready.pop_back();
+      return p;
+    }
+
+    StaffCore( const LogicalProcess** PROCESS, unsigned lower, unsigned upper, unsigned initial, Dispatch dispatch ):
+      LOWER  { std::max( 1u, lower )                    },
+      UPPER  { std::max( LOWER, upper )                 },
+      member { std::make_unique< Member[] >( UPPER )    },
+      engaged{ 0                                        },
+      INITIAL{ std::clamp( initial, LOWER, UPPER )      },
+      topology{                                         },
+      DISPATCH{ dispatch                                },
+      tickets { 0                                       },
+      agenda  {                                         },
+      ready   {                                         },
+      pending {                                         },
+      injection{                                        },
+      inbox   {                                         },
+      injected{ 0                                       },
+      affine  { Config::staff::LOCALITY                 },
+      migrated{ 0                                       },
+      stolen  { 0                                       },
+      registration{                                     },
+      registry{                                         },
+      retirees{                                         },
+      population{ 0                                     },
+      limbo   { 0                                       },
+      epoch   { 1                                       },
+      circulating{ false                                },
+      timing  {                                         },
+      wheel   { tickOf( LogicalProcess::now() )         },
+      horizon { NEVER                                   },
+      timers  { 0                                       },
+      guards  {                                         },
+      dozing  {                                         },
+      bell    {                                         },
+      sleepers{ 0                                       },
+      tasks   { UPPER, [this]{ ring(); }                }
+    {
+      for( unsigned i = 0; i < UPPER; i++ ){
+        member[i].name  = nameOf( i );
+        member[i].staff = this;
+        member[i].index = i;
+      }
+                                                                                                                              /*
+      Initial round-robin distribution of processes between deques of initially engaged
+      members (threads not started yet, so pushing on behalf of the owners is safe);
+      processes that don`t fit into the deques go to the shared inbox:
+                                                                                                                              */
+      for( unsigned i = 0; PROCESS[i]; i++ ){ registry.push_back( PROCESS[i] ); PROCESS[i]->assign( this ); }
+      population.store( registry.size() );
+      if( DISPATCH == Dispatch::DEADLINE ) return; // :agenda filled at start
+      for( unsigned i = 0; i < registry.size(); i++ ){
+        if( not member[ i % INITIAL ].deque.push( registry[i] ) ) inbox.push_back( registry[i] );
       }
+      injected.store( inbox.size() );
     }//constructor
 
+    StaffCore( const StaffCore& )              = delete;
+    StaffCore& operator = ( const StaffCore& ) = delete;
+
+    bool engage(){
+                                                                                                                              /*
+      Start one more member; returns `false` if upper bound reached:
+                                                                                                                              */
+      const unsigned n{ engaged.load() };
+      if( n >= UPPER ) return false;
+      member[n].start();
+      engaged.store( n + 1 );
+      return true;
+    }
+
+    bool disengage(){
+                                                                                                                              /*
+      Stop last engaged member; its deque stays available for stealing.
+      Returns `false` if lower bound reached:
+                                                                                                                              */
+      const unsigned n{ engaged.load() };
+      if( n <= LOWER ) return false;
+      member[ n-1 ].stop();
+      { std::lock_guard< std::mutex > lock( dozing ); bell.notify_all(); }
+      if( member[ n-1 ].thread.joinable() ) member[ n-1 ].thread.join();
+      engaged.store( n - 1 );
+      return true;
+    }
+
+  public:
+
+    void resume( const LogicalProcess* p ) override {
+                                                                                                                              /*
+      Woken up process returns into the runnable set: to the member that executed it last
+      (warm cache) if that member can take it at once, otherwise into the shared inbox, so
+      the process doesn`t wait for the member`s current step, doze or OS time slice (members
+      oversubscribing CPU) while other members are free:
+                                                                                                                              */
+      if( DISPATCH == Dispatch::DEADLINE ){ enlist( p ); return; }
+      if( affine.load( std::memory_order_relaxed ) ){
+        const int m{ p->placement().member.load( std::memory_order_relaxed ) };
+        if( m >= 0 and receptive( unsigned( m ) ) ){ deliver( unsigned( m ), p ); return; }
+      }
+      {
+        std::lock_guard< std::mutex > lock( injection );
+        inbox.push_back( p );
+        injected.store( inbox.size() );
+      }
+      ring();
+    }
+
+    Timeout scheduleAt( const Timepoint& t, std::function< void() > action ){
+                                                                                                                              /*
+      One-shot action executed by some member at `t` (with WHEEL_TICK resolution):
+                                                                                                                              */
+      return arm( t, Alarm{ nullptr, false, std::move( action ) } );
+    }
+
+    Timeout timeout( const LogicalProcess* p, const Duration& d ){
+                                                                                                                              /*
+      Parked process resumed after `d` even if not woken up by the wait-list it parked on;
+      `LogicalProcess::timedOut` reports expiration to the step. Timeout must be cancelled
+      when not needed anymore, otherwise it withdraws the process parked again later;
+      timeouts still pending when the process removed are cancelled by Staff:
+                                                                                                                              */
+      return arm( LogicalProcess::now() + d, Alarm{ p, true, {} } );
+    }
+
+    bool cancel( const Timeout& handle ){
+                                                                                                                              /*
+      Returns `false` if the timer fired or cancelled already:
+                                                                                                                              */
+      std::lock_guard< std::mutex > lock( timing );
+      const bool cancelled{ wheel.cancel( handle ) };
+      timers.store( wheel.size() );
+      return cancelled;
+    }
+
+    unsigned size() const { return engaged.load(); }
+
+    const Topology& cpuTopology() const { return topology; }
+
+    void place( Placement placement, const std::vector< int >& list = {} ){
+                                                                                                                              /*
+      Assign CPU to members; takes effect when member (re)started:
+                                                                                                                              */
+      const auto cpu = topology.place( placement, UPPER, list );
+      for( unsigned i = 0; i < UPPER; i++ ) member[i].cpu = cpu[i];
+    }
+
+    unsigned processes() const { return population.load(); }
+
+    TaskPool& taskPool(){ return tasks; } // :for `TaskGroup` created outside of members
+
+    void     locality  ( bool on )       { affine.store( on );       } // :STEALING dispatch only
+    bool     locality  (         ) const { return affine.load();     }
+    uint64_t migrations(         ) const { return migrated.load();   } // :moves to co-locate with Fluid users
+    uint64_t steals    (         ) const { return stolen.load();     } // :moves to rebalance load
+
+    std::vector< const LogicalProcess* > registered(){
+      std::lock_guard< std::mutex > lock( registration );
+      return registry;
+    }
+
+    template< typename F > void surveyMembers( F&& visit ) const {
+                                                                                                                              /*
+      Observation without touching members: `visit( name, statistics, dozed, cpu, engaged )`
+      called for every member; counters are read relaxed, so they can be slightly stale:
+                                                                                                                              */
+      const unsigned n{ engaged.load() };
+      for( unsigned i = 0; i < UPPER; i++ ){
+        const Member& M = member[i];
+        visit( M.name, M.stat, M.dozed.load( std::memory_order_relaxed ), M.cpu, i < n );
+      }
+    }
+
+    template< typename F > void surveyOccupancy( F&& visit ) const {
+                                                                                                                              /*
+      `visit( index, name, occupancy )` for every member; slots sampled as described in
+      `LogicalProcess::Occupancy`:
+                                                                                                                              */
+      for( unsigned i = 0; i < UPPER; i++ ) visit( i, member[i].name, member[i].occupancy );
+    }
+
+    template< typename F > void surveyProcesses( F&& visit ){
+                                                                                                                              /*
+      `visit( process )` called for every registered process under registration lock, so
+      removed process can`t be reclaimed meanwhile:
+                                                                                                                              */
+      std::lock_guard< std::mutex > lock( registration );
+      for( auto p: registry ) visit( p );
+    }
+
+    void add( const LogicalProcess* p ){
+                                                                                                                              /*
+      Register process and make it runnable (running Staff picks it up immediately):
+                                                                                                                              */
+      std::lock_guard< std::mutex > lock( registration );
+      registry.push_back( p );
+      population.store( registry.size() );
+      p->assign( this );
+      if( DISPATCH == Dispatch::DEADLINE and not circulating ) return; // :enlisted at start
+      circulate( p );
+    }
+
+    void remove( const LogicalProcess* p, std::function< void( const LogicalProcess* ) > reclaim = {} ){
+                                                                                                                              /*
+      Unregister process; `reclaim` called (by some member or by `collect` caller) when no
+      member can touch the process anymore, so the process may be destroyed there:
+                                                                                                                              */
+      {
+        std::lock_guard< std::mutex > lock( registration );
+        const auto i = std::find( registry.begin(), registry.end(), p );
+        if( i == registry.end() ) return;
+        registry.erase( i );
+        population.store( registry.size() );
+        retirees.push_back( Retiree{ p, 0, reclaim } );
+      }
+      p->retire();
+      if( p->withdraw() ) dismiss( p ); // :was parked, so already out of the runnable set
+      collect();
+    }
+
+    void replace( const LogicalProcess* old, const LogicalProcess* fresh, std::function< void( const LogicalProcess* ) > reclaim = {} ){
+      add( fresh );
+      remove( old, reclaim );
+    }
+
+    void collect(){
+                                                                                                                              /*
+      Hand over retirees that no running member can hold: member that took the process
+      started its iteration before the retirement, so its epoch is less than retiree's:
+                                                                                                                              */
+      std::vector< Retiree > free;
+      {
+        std::lock_guard< std::mutex > lock( registration );
+        uint64_t safe{ epoch.load() };
+        for( unsigned i = 0; i < UPPER; i++ ){
+          const uint64_t e{ member[i].epoch.load() };
+          if( e > 0 ) safe = std::min( safe, e );
+        }
+        for( auto R = retirees.begin(); R != retirees.end(); ){
+          if( R->epoch > 0 and R->epoch <= safe ){ free.push_back( std::move( *R ) ); R = retirees.erase( R ); limbo--; }
+          else R++;
+        }
+      }
+      for( auto& R: free ) if( R.reclaim ) R.reclaim( R.process );
+    }
+
     void start(){
-      for( auto& m: member ) m.start();
+      if( DISPATCH == Dispatch::DEADLINE and not circulating ){
+        std::lock_guard< std::mutex > lock( registration );
+        const Timepoint now{ LogicalProcess::now() };
+        for( auto p: registry ){ p->release( now, tickets++ ); enlist( p ); }
+        circulating = true;
+      }
+      while( engaged.load() < INITIAL ) engage();
     }
 
     void stop(){
-      for( auto& m: member ) m.stop();
+      for( unsigned i = 0; i < UPPER; i++ ) member[i].stop();
+      { std::lock_guard< std::mutex > lock( dozing ); bell.notify_all(); }
       for(;;){
         std::this_thread::yield();
         unsigned live{ 0 };
-        for( auto& m: member ) if( m.live() ) live++;
+        for( unsigned i = 0; i < UPPER; i++ ) if( member[i].live() ) live++;
         if( live == 0 ) break;
       }
-      for( auto& m: member ) if( m.thread.joinable() ) m.thread.join();
+      for( unsigned i = 0; i < UPPER; i++ ) if( member[i].thread.joinable() ) member[i].thread.join();
+      engaged.store( 0 );
     }
 
-   ~Staff(){ stop(); }
+   ~StaffCore(){
+      stop();
+                                                                                                                              /*
+      Processes parked on wait-lists taken back, so the Fluid (Mailbox) that outlives the
+      process doesn`t wake destroyed one and the process can be executed by another Staff:
+                                                                                                                              */
+      for( auto p: registry ){ p->withdraw(); p->assign( nullptr ); }
+                                                                                                                              /*
+      No member runs, so all retirees can be reclaimed; ones still parked withdrawn first:
+                                                                                                                              */
+      for( auto& R: retirees ){
+        if( R.epoch == 0 ) R.process->withdraw();
+        if( R.reclaim ) R.reclaim( R.process );
+      }
+    }
+
+  };//StaffCore
+
+                                                                                                                              /*
+  Staff with number of members fixed at compile time:
+                                                                                                                              */
+  template< unsigned STAFF > class Staff: public StaffCore {
+
+    static_assert( STAFF > 0 );
+
+  public:
+
+    Staff( const LogicalProcess** PROCESS, Dispatch dispatch = Dispatch::STEALING ):
+      StaffCore( PROCESS, STAFF, STAFF, STAFF, dispatch ){}
 
   };// Staff
 
+                                                                                                                              /*
+  Staff that follows the load: initial number of members is the number of CPU available
+  for the process (CPU quota of the container and affinity mask, see `cpu.h`); `governor`
+  thread periodically evaluates utilization of the engaged members as a fraction of DONE
+  results among all results (IDLE includes attempts that found no process to execute,
+  BUSY and FAIL mean contention) scaled by fraction of time members not dozed and engages or disengages one member at a time;
+  engagement is kept only if it increases number of DONE steps:
+                                                                                                                              */
+  class ElasticStaff: public StaffCore {
+
+    std::thread         governor;
+    std::atomic< bool > terminate;
+
+    void govern(){
+      auto log = logger.log( "governor" );
+      log.vital( kit( "Elastic staff: %u..%u members, %u CPU available, %u engaged", LOWER, UPPER, cpu::available(), size() ) );
+      using R = LogicalProcess::Statistics;
+      double last[4]{ 0, 0, 0, 0 };
+      auto sample = [&]( double delta[4] ){
+        double now[4]{ 0, 0, 0, 0 };
+        for( unsigned i = 0; i < UPPER; i++ ) for( unsigned j = 0; j < 4; j++ ) now[j] += member[i].stat[ R::RESULT( j ) ];
+        for( unsigned j = 0; j < 4; j++ ){ delta[j] = now[j] - last[j]; last[j] = now[j]; }
+      };
+      double   delta[4];
+      double   slept  { 0     }; // :total doze time of members, nanosec
+      double   before { 0     }; // :DONE per period before last engagement
+      bool     probing{ false }; // :last engagement not evaluated yet
+      unsigned hold   { 0     }; // :periods to wait before next engagement
+      auto doze = [&]()->double {
+        double now{ 0 };
+        for( unsigned i = 0; i < UPPER; i++ ) now += double( member[i].dozed.load() );
+        const double d{ now - slept };
+        slept = now;
+        return d;
+      };
+      sample( delta );
+      doze();
+      while( not terminate.load() ){
+        pause{ Config::staff::GOVERNOR_PERIOD }[ MILLISEC ];
+        if( terminate.load() ) break;
+        sample( delta );
+                                                                                                                              /*
+        Dozing member counts nothing, so the DONE fraction is scaled by the awake fraction
+        of the members time:
+                                                                                                                              */
+        const double awake{ 1.0 - std::min( 1.0, doze()/( 1.0e6*Config::staff::GOVERNOR_PERIOD*size() ) ) };
+        const double total{ delta[ R::IDLE ] + delta[ R::BUSY ] + delta[ R::DONE ] + delta[ R::FAIL ] };
+        if( total <= 0 ) continue;
+        const double utilization{ awake*delta[ R::DONE ]/total };
+                                                                                                                              /*
+        Engagement that did not increase throughput (CPU quota exhausted, memory bandwidth
+        and so on) is rolled back; next attempt is postponed:
+                                                                                                                              */
+        if( probing ){
+          probing = false;
+          if( delta[ R::DONE ] < before*Config::staff::ENGAGE_GAIN ){
+            hold = Config::staff::GOVERNOR_HOLD;
+            if( disengage() ) log.brief( kit( "no throughput gain: disengaged, %u members", size() ) );
+            continue;
+          }
+        }
+        if( hold > 0 ) hold--;
+        if( utilization > Config::staff::ENGAGE_UTILIZATION and size() < processes() ){
+          if( hold > 0 ) continue;
+          before = delta[ R::DONE ];
+          if( engage() ){
+            probing = true;
+            log.brief( kit( "utilization %5.1f %%: engaged, %u members", 100*utilization, size() ) );
+          }
+        } else if( utilization < Config::staff::DISENGAGE_UTILIZATION ){
+          if( disengage() ) log.brief( kit( "utilization %5.1f %%: disengaged, %u members", 100*utilization, size() ) );
+        }
+      }
+    }
+
+  public:
+
+    ElasticStaff( const LogicalProcess** PROCESS, unsigned lower = 1, unsigned upper = std::thread::hardware_concurrency(),
+                  Dispatch dispatch = Dispatch::STEALING ):
+      StaffCore( PROCESS, lower, upper, cpu::available(), dispatch ), governor{}, terminate{ false }{}
+
+    void start(){
+      StaffCore::start();
+      terminate.store( false );
+      governor = std::thread( &ElasticStaff::govern, this );
+    }
+
+    void stop(){
+      terminate.store( true );
+      if( governor.joinable() ) governor.join();
+      StaffCore::stop();
+    }
+
+   ~ElasticStaff(){ stop(); }
+
+  };//ElasticStaff
+
 }//namespace CoreAGI
 
 #endif // STAFF_H_INCLUDED
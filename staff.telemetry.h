@@ -0,0 +1,169 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Publisher of Staff telemetry: own thread periodically surveys members, registered
+ processes and watched Fluids and copies their counters into the shared memory segment
+ (see `telemetry.h`). Members and processes are not involved: counters are the ones
+ they maintain anyway (`LogicalProcess::Statistics`, `Latency`, doze time, Fluid denials),
+ read relaxed by the publisher only.
+
+   TelemetryPublisher telemetry( staff );
+   telemetry.watch( "data", fluid );
+   telemetry.start();
+   ...
+   telemetry.stop();
+
+ Watched Fluids must outlive the publisher (or its `stop`).
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef STAFF_TELEMETRY_H_INCLUDED
+#define STAFF_TELEMETRY_H_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "fluid.h"
+#include "logical.process.h"
+#include "staff.h"
+#include "telemetry.h"
+
+namespace CoreAGI {
+
+  class TelemetryPublisher {
+
+    StaffCore&                                             staff;
+    TelemetrySegment                                       segment;
+    const unsigned                                         PERIOD;   // :millisec
+    std::mutex                                             watching; // :protects `fluids`
+    std::mutex                                             writing;  // :serializes `publish`: sequence lock of the segment has single writer
+    std::vector< std::pair< std::string, const FluidCore* > > fluids;
+    std::thread                                            thread;
+    std::mutex                                             guard;    // :protects `terminate`
+    std::condition_variable                                bell;     // :rung by `stop`
+    bool                                                   terminate;
+
+    void fill( Telemetry& T ){
+      using R = LogicalProcess::Statistics;
+      T.period  = PERIOD;
+      T.workers = 0;
+      staff.surveyMembers( [&]( const std::string& name, const R& stat, uint64_t dozed, int cpu, bool engaged ){
+        if( T.workers >= Telemetry::WORKERS ) return;
+        Telemetry::Worker& W = T.worker[ T.workers++ ];
+        Telemetry::label( W.name, name.c_str() );
+        W.cpu     = cpu;
+        W.engaged = engaged;
+        for( unsigned j = 0; j < 4; j++ ) W.count[j] = stat[ R::RESULT( j ) ];
+        W.dozed   = dozed;
+      });
+      T.processes = 0;
+      staff.surveyProcesses( [&]( const LogicalProcess* p ){
+        if( T.processes >= Telemetry::PROCESSES ) return;
+        Telemetry::Process& P = T.process[ T.processes++ ];
+        Telemetry::label( P.name, p->name() );
+        P.live   = p->live();
+        P.parked = p->parked();
+        for( unsigned j = 0; j < R::SIZE; j++ ) P.count[j] = p->statistics().sum( j );
+        const auto& L = p->latencies();
+        P.steps    = L.step.count();
+        P.step [0] = L.step .quantile( 0.5  ); P.step [1] = L.step .quantile( 0.99 ); P.step [2] = L.step .max();
+        P.delay[0] = L.delay.quantile( 0.5  ); P.delay[1] = L.delay.quantile( 0.99 ); P.delay[2] = L.delay.max();
+      });
+      std::lock_guard< std::mutex > lock( watching );
+      T.fluids = 0;
+      for( const auto& [ name, fluid ]: fluids ){
+        if( T.fluids >= Telemetry::FLUIDS ) break;
+        Telemetry::Fluid& F = T.fluid[ T.fluids++ ];
+        Telemetry::label( F.name, name.c_str() );
+        const FluidCore::Unpacked state{ fluid->state() };
+        F.state   = "OIWrRfF"[ std::min( unsigned( state.state ), 6u ) ];
+        F.readers = state.num;
+        F.parked  = fluid->parked();
+        F.denied  = fluid->denials();
+      }
+    }
+
+    void run(){
+      std::unique_lock< std::mutex > lock( guard );
+      while( not terminate ){
+        lock.unlock();
+        publish();
+        lock.lock();
+        bell.wait_for( lock, std::chrono::milliseconds( PERIOD ), [&]{ return terminate; } ); // :`stop` doesn`t wait for the period
+      }
+      lock.unlock();
+      publish(); // :final counters stay visible until the segment unlinked
+    }
+
+  public:
+
+    TelemetryPublisher( StaffCore& observed, const char* name = Config::telemetry::SEGMENT,
+                        unsigned period = Config::telemetry::PERIOD ):
+      staff    { observed                   },
+      segment  { name, true                 },
+      PERIOD   { std::max( 1u, period )     },
+      watching {                            },
+      writing  {                            },
+      fluids   {                            },
+      thread   {                            },
+      guard    {                            },
+      bell     {                            },
+      terminate{ false                      }
+    {}
+
+    TelemetryPublisher( const TelemetryPublisher& )              = delete;
+    TelemetryPublisher& operator = ( const TelemetryPublisher& ) = delete;
+
+    explicit operator bool() const { return bool( segment ); } // :segment created
+
+    const std::string& path() const { return segment.path(); }
+
+    void watch( const std::string& name, const FluidCore& fluid ){
+      std::lock_guard< std::mutex > lock( watching );
+      fluids.emplace_back( name, &fluid );
+    }
+
+    void publish(){
+                                                                                                                              /*
+      Called by the publisher thread and by anyone who wants fresh counters right now:
+                                                                                                                              */
+      if( not segment ) return;
+      std::lock_guard< std::mutex > lock( writing );
+      segment->publish( [&]( Telemetry& T ){ fill( T ); } );
+    }
+
+    void start(){
+      if( not segment or thread.joinable() ) return;
+      terminate = false;
+      thread = std::thread( &TelemetryPublisher::run, this );
+    }
+
+    void stop(){
+      {
+        std::lock_guard< std::mutex > lock( guard );
+        terminate = true;
+      }
+      bell.notify_all();
+      if( thread.joinable() ) thread.join();
+    }
+
+   ~TelemetryPublisher(){ stop(); }
+
+  };//TelemetryPublisher
+
+}//namespace CoreAGI
+
+#endif // STAFF_TELEMETRY_H_INCLUDED
@@ -0,0 +1,192 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Live telemetry segment: fixed layout block of POSIX shared memory where a publisher
+ (see `staff.telemetry.h`) periodically puts counters of Staff members, logical processes
+ and Fluids, and observers (see `coherent.top.cpp`) read them from other processes.
+
+ Segment protected by sequence lock: publisher makes the sequence odd, rewrites the
+ block and makes it even again; observer copies the block and accepts the copy only if
+ the sequence was even and did not change meanwhile. Observer never writes into the
+ segment (it is mapped read-only), so it can`t slow down or block the publisher.
+
+ Layout contains only fixed size plain fields; observer checks MAGIC, VERSION and size
+ before use.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef TELEMETRY_H_INCLUDED
+#define TELEMETRY_H_INCLUDED
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+
+namespace CoreAGI {
+
+  struct Telemetry {
+
+    static constexpr uint32_t MAGIC    { 0x54484F43 }; // :`COHT`
+    static constexpr uint32_t VERSION  { 1          };
+    static constexpr unsigned NAME     { Config::telemetry::NAME_CAPACITY    };
+    static constexpr unsigned WORKERS  { Config::telemetry::WORKER_CAPACITY  };
+    static constexpr unsigned PROCESSES{ Config::telemetry::PROCESS_CAPACITY };
+    static constexpr unsigned FLUIDS   { Config::telemetry::FLUID_CAPACITY   };
+
+    struct Worker {
+      char     name[ NAME ];
+      int32_t  cpu;       // :CPU the member pinned to, -1 if not pinned
+      uint32_t engaged;   // :1 if member runs
+      uint64_t count[4];  // :IDLE, BUSY, DONE, FAIL (see `LogicalProcess::Statistics`)
+      uint64_t dozed;     // :total doze time, nanosec
+    };
+
+    struct Process {
+      char     name[ NAME ];
+      uint32_t live;      // :1 if process active
+      uint32_t parked;    // :1 if process parked on a Fluid or Mailbox
+      uint64_t count[7];  // :IDLE, BUSY, DONE, FAIL, LATE, OVER, WAIT
+      uint64_t steps;     // :number of timed steps
+      uint64_t step [3];  // :step duration p50, p99, max; nanosec
+      uint64_t delay[3];  // :from becoming runnable to step start p50, p99, max; nanosec
+    };
+
+    struct Fluid {
+      char     name[ NAME ];
+      char     state;     // :automaton state (see `FluidCore::State`)
+      uint32_t readers;   // :number of readers inside
+      uint32_t parked;    // :waiters parked on the wait-list
+      uint64_t denied;    // :denied access requests
+    };
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sequence;    // :sequence lock; odd while publisher writes
+    uint64_t publisher;   // :process id of the publisher
+    uint64_t published;   // :CLOCK_MONOTONIC time of the last publication, nanosec
+    uint64_t serial;      // :number of publications
+    uint32_t period;      // :publication period, millisec
+    uint32_t workers;     // :used entries of `worker`
+    uint32_t processes;   // :used entries of `process`
+    uint32_t fluids;      // :used entries of `fluid`
+    Worker   worker [ WORKERS   ];
+    Process  process[ PROCESSES ];
+    Fluid    fluid  [ FLUIDS    ];
+
+    static uint64_t clock(){
+      timespec t;
+      clock_gettime( CLOCK_MONOTONIC, &t ); // :common for all processes of the host
+      return uint64_t( t.tv_sec )*1000000000ull + uint64_t( t.tv_nsec );
+    }
+
+    static void label( char ( &target )[ NAME ], const char* source ){
+      std::strncpy( target, source ? source : "", NAME - 1 );
+      target[ NAME - 1 ] = 0;
+    }
+
+    template< typename F > void publish( F&& fill ){
+                                                                                                                              /*
+      Writer side of the sequence lock; single publisher assumed:
+                                                                                                                              */
+      std::atomic_ref< uint64_t > S( sequence );
+      const uint64_t s{ S.load( std::memory_order_relaxed ) };
+      S.store( s + 1, std::memory_order_relaxed );
+      std::atomic_thread_fence( std::memory_order_release );
+      fill( *this );
+      published = clock();
+      serial++;
+      S.store( s + 2, std::memory_order_release );
+    }
+
+    bool snapshot( Telemetry& copy, unsigned attempts = 100 ) const {
+                                                                                                                              /*
+      Reader side of the sequence lock; returns `false` if publisher was writing during all
+      attempts:
+                                                                                                                              */
+      std::atomic_ref< uint64_t > S( const_cast< uint64_t& >( sequence ) );
+      for( unsigned attempt = 0; attempt < attempts; attempt++ ){
+        const uint64_t before{ S.load( std::memory_order_acquire ) };
+        if( before & 1 ){ usleep( 100 ); continue; }
+        std::memcpy( static_cast< void* >( &copy ), this, sizeof( Telemetry ) );
+        std::atomic_thread_fence( std::memory_order_acquire );
+        if( S.load( std::memory_order_relaxed ) == before ) return true;
+      }
+      return false;
+    }
+
+  };//Telemetry
+
+  static_assert( std::is_trivially_copyable_v< Telemetry > );
+
+                                                                                                                              /*
+  Telemetry segment mapped into the address space: publisher creates (and finally
+  unlinks) it, observer opens existing one read-only:
+                                                                                                                              */
+  class TelemetrySegment {
+
+    std::string name;
+    Telemetry*  block;
+    bool        owner;
+
+  public:
+
+    TelemetrySegment( const char* segment, bool create ): name{ segment }, block{ nullptr }, owner{ create } {
+      const int fd = create ? shm_open( segment, O_CREAT | O_RDWR, 0644 ) : shm_open( segment, O_RDONLY, 0 );
+      if( fd < 0 ) return;
+      struct stat S;
+      const bool sized{ create ? ftruncate( fd, sizeof( Telemetry ) ) == 0
+                               : fstat( fd, &S ) == 0 and size_t( S.st_size ) >= sizeof( Telemetry ) };
+      void* address = sized ? mmap( nullptr, sizeof( Telemetry ), create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0 )
+                            : MAP_FAILED;
+      close( fd );
+      if( address == MAP_FAILED ){ if( create ) shm_unlink( segment ); return; }
+      block = static_cast< Telemetry* >( address );
+      if( create ){
+        std::memset( static_cast< void* >( block ), 0, sizeof( Telemetry ) );
+        block->magic     = Telemetry::MAGIC;
+        block->version   = Telemetry::VERSION;
+        block->publisher = uint64_t( getpid() );
+      } else if( block->magic != Telemetry::MAGIC or block->version != Telemetry::VERSION ){
+        munmap( address, sizeof( Telemetry ) );
+        block = nullptr;
+      }
+    }
+
+    TelemetrySegment( const TelemetrySegment& )              = delete;
+    TelemetrySegment& operator = ( const TelemetrySegment& ) = delete;
+
+    explicit operator bool() const { return block != nullptr; }
+
+    const std::string& path() const { return name; }
+
+          Telemetry* operator -> ()       { return block; }
+    const Telemetry* operator -> () const { return block; }
+
+   ~TelemetrySegment(){
+      if( block ) munmap( block, sizeof( Telemetry ) );
+      if( block and owner ) shm_unlink( name.c_str() );
+    }
+
+  };//TelemetrySegment
+
+}//namespace CoreAGI
+
+#endif // TELEMETRY_H_INCLUDED
@@ -19,6 +19,10 @@
 
  2022.02.11  Added method `fraction( Duration& )`
 
+ 2026.10.18  Timer and pause follow virtual clock when it is engaged (see `chronos.h`)
+
+ 2026.10.18  Timer keeps the time base (virtual or steady clock) chosen when started
+
 ________________________________________________________________________________________________________________________________
                                                                                                                               */
 #ifndef TIMER_H_INCLUDED
@@ -28,6 +32,7 @@ ________________________________________________________________________________
 #include <chrono>
 #include <thread>
 
+#include "chronos.h"
 #include "semantic.type.h"
 
 namespace CoreAGI {
@@ -42,6 +47,11 @@ namespace CoreAGI {
     unsigned t;
     constexpr pause( const unsigned& n ): t{ n }{};
     void operator[] ( const TimeUnit& unit ){
+      if( VirtualClock::owned() ){ // :simulation driver thread does not sleep, it advances time
+        constexpr double TIME_FACTOR[4] = { 1.0, 1.0e+3, 1.0e+6, 1.0e+9 };
+        VirtualClock::advance( t*TIME_FACTOR[ int( unit ) ] );
+        return;
+      }
       switch( unit ){
         case NANOSEC  : std::this_thread::sleep_for( std::chrono::nanoseconds ( t ) ); return;
         case MICROSEC : std::this_thread::sleep_for( std::chrono::microseconds( t ) ); return;
@@ -57,36 +67,46 @@ namespace CoreAGI {
 
     using Clock = std::chrono::steady_clock;
 
+            bool                             simulated; // :virtual clock was engaged when started
             std::chrono::time_point< Clock > to;
     mutable std::chrono::time_point< Clock > tt;
 
+    std::chrono::time_point< Clock > now() const {
+                                                                                                                              /*
+      Time base of the start kept even if virtual clock engaged or disengaged since then,
+      so durations never mix steady and virtual time:
+                                                                                                                              */
+      if( not simulated ) return Clock::now();
+      return std::chrono::time_point< Clock >( std::chrono::nanoseconds( int64_t( VirtualClock::now() ) ) );
+    }
+
   public:
 
-    Timer(): to{ Clock::now() }, tt{ to }{ }
+    Timer(): simulated{ VirtualClock::engaged() }, to{ now() }, tt{ to }{ }
 
-    void   start(){ to = tt = Clock::now();          }
-    Timer& stop (){ tt = Clock::now(); return *this; }                                                         // [+] 2022.01.13
+    void   start(){ simulated = VirtualClock::engaged(); to = tt = now(); }
+    Timer& stop (){ tt = now(); return *this;        }                                                         // [+] 2022.01.13
 
     double fraction( const Duration& T ) const { return usec()/T[ MICROSEC ]; }                                // [+] 2022.02.11
 
     [[deprecated]] double elapsed( const TimeUnit& unit = MILLISEC ) const {
       constexpr double TIME_UNIT[4] = { 1.0, 1.0e-3, 1.0e-6, 1.0e-9 };
-      return TIME_UNIT[ unit ]*double( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() );
+      return TIME_UNIT[ unit ]*double( std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() );
     }
 
 //    [[deprecated]] Duration operator()( const TimeUnit& unit = MILLISEC ) const {
 //      return Duration::Value( std::chrono::duration_cast< std::chrono::nanoseconds >( tt - to ).count() )[ unit ];
 //    }
 
-    double nsec() const{ tt=Clock::now(); return        std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
-    double usec() const{ tt=Clock::now(); return 1.0e-3*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
-    double msec() const{ tt=Clock::now(); return 1.0e-6*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
-    double  sec() const{ tt=Clock::now(); return 1.0e-9*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
+    double nsec() const{ tt=now(); return        std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
+    double usec() const{ tt=now(); return 1.0e-3*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
+    double msec() const{ tt=now(); return 1.0e-6*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
+    double  sec() const{ tt=now(); return 1.0e-9*std::chrono::duration_cast< std::chrono::nanoseconds >(tt-to).count(); }
 
     double operator[]( const TimeUnit& unit ) const {
 //    return Duration::Value( std::chrono::duration_cast< std::chrono::nanoseconds >( tt - to ).count() )[ unit ];
       constexpr double TIME_UNIT[4] = { 1.0, 1.0e-3, 1.0e-6, 1.0e-9 };
-      return TIME_UNIT[ unit ]*double( std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() );
+      return TIME_UNIT[ unit ]*double( std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() );
     }
 
     Duration operator()() const {
@@ -94,19 +114,19 @@ namespace CoreAGI {
     }
 
     bool operator < ( const Duration& dt ) const {
-      return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() < dt.endo();
+      return std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() < dt.endo();
     }
 
     bool operator <= ( const Duration& dt ) const {
-      return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() <= dt.endo();
+      return std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() <= dt.endo();
     }
 
     bool operator > ( const Duration& dt ) const {
-      return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() > dt.endo();
+      return std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() > dt.endo();
     }
 
     bool operator >= ( const Duration& dt ) const {
-      return std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - to ).count() > dt.endo();
+      return std::chrono::duration_cast< std::chrono::nanoseconds >( now() - to ).count() > dt.endo();
     }
 
   };//Timer
@@ -0,0 +1,220 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Hierarchical timing wheel: LEVELS wheels of SLOTS slots each; slot of level `l` spans
+ SLOTS^l ticks. Timer placed into the lowest level that covers its due tick and moved
+ down (cascaded) when the lower wheel completes revolution, so scheduling, cancelling
+ and firing cost O(1) regardless of number of timers.
+
+ Timers are entries of the pool (linked into slot lists by indices); a handle is the
+ entry index together with generation of the entry, so cancelling of fired or already
+ cancelled timer is safe and does nothing.
+
+ Not thread-safe: owner (see `StaffCore`) serializes access.
+
+ 2026.10.18  Initial version
+
+ 2026.10.18  `horizon` takes the earliest slot over all levels (first non-empty slot of the lowest
+             level doesn`t bound timers of upper levels once time passed since they linked);
+             `advance` jumps over ticks without due timers and cascades
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef TIMING_WHEEL_H_INCLUDED
+#define TIMING_WHEEL_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CoreAGI {
+
+  struct TimerHandle {
+    int      index     { -1 }; // :entry of the wheel
+    unsigned generation{  0 };
+    explicit operator bool() const { return index >= 0; }
+  };
+
+  template< typename Payload, unsigned SLOTS = 256, unsigned LEVELS = 4 > class TimingWheel {
+
+    static_assert( std::has_single_bit( SLOTS ) );
+
+    static constexpr unsigned BITS{ unsigned( std::bit_width( SLOTS ) - 1 ) };
+    static constexpr uint64_t MASK{ SLOTS - 1                               };
+    static constexpr int      NONE{ -1                                      };
+
+    struct Entry {
+      uint64_t due;        // :tick
+      int      next;       // :next entry in slot list or in free list
+      int      prev;
+      int      slot;       // :level*SLOTS + index, NONE if vacant
+      unsigned generation; // :incremented when entry vacated
+      Payload  payload;
+    };
+
+    std::vector< Entry > entry;
+    std::vector< int   > head;    // :LEVELS*SLOTS slot lists
+    int                  vacant;  // :free list
+    uint64_t             current; // :last processed tick
+    unsigned             count;   // :number of scheduled timers
+
+    static uint64_t span( unsigned level ){ return uint64_t( 1 ) << ( BITS*level ); } // :ticks per slot
+
+    void link( int i ){
+                                                                                                                              /*
+      Put entry into slot that corresponds its due tick relative to current one; too far
+      timers kept in the last slot of the top level and cascaded later:
+                                                                                                                              */
+      Entry& E = entry[i];
+      const uint64_t delta{ E.due - current };
+      unsigned level{ 0 };
+      while( level + 1 < LEVELS and delta >= span( level + 1 ) ) level++;
+      const uint64_t due{ delta >= span( LEVELS ) ? current + span( LEVELS ) - 1 : E.due };
+      const int s = int( level*SLOTS + ( ( due >> ( BITS*level ) ) & MASK ) );
+      E.slot = s;
+      E.prev = NONE;
+      E.next = head[s];
+      if( head[s] != NONE ) entry[ head[s] ].prev = i;
+      head[s] = i;
+    }
+
+    void unlink( int i ){
+      Entry& E = entry[i];
+      if( E.prev != NONE ) entry[ E.prev ].next = E.next; else head[ E.slot ] = E.next;
+      if( E.next != NONE ) entry[ E.next ].prev = E.prev;
+      E.slot = NONE;
+    }
+
+    void vacate( int i ){
+      Entry& E = entry[i];
+      E.generation++;
+      E.payload = Payload{};
+      E.next    = vacant;
+      vacant    = i;
+      count--;
+    }
+
+    void cascade( unsigned level ){
+                                                                                                                              /*
+      Redistribute timers of the current slot of `level` over lower levels:
+                                                                                                                              */
+      const int s = int( level*SLOTS + ( ( current >> ( BITS*level ) ) & MASK ) );
+      int i = head[s];
+      head[s] = NONE;
+      while( i != NONE ){
+        const int next{ entry[i].next };
+        entry[i].slot = NONE;
+        link( i );
+        i = next;
+      }
+    }
+
+  public:
+
+    using Handle = TimerHandle; // :doesn`t depend on payload, so owner can expose it
+
+    explicit TimingWheel( uint64_t now = 0 ):
+      entry{}, head( LEVELS*SLOTS, NONE ), vacant{ NONE }, current{ now }, count{ 0 }{}
+
+    unsigned size() const { return count;   }
+    uint64_t tick() const { return current; }
+
+    Handle schedule( uint64_t due, const Payload& payload ){
+                                                                                                                              /*
+      Timer due in the past fires at the next `advance`:
+                                                                                                                              */
+      int i;
+      if( vacant != NONE ){ i = vacant; vacant = entry[i].next; }
+      else { i = int( entry.size() ); entry.push_back( Entry{ 0, NONE, NONE, NONE, 0, Payload{} } ); }
+      Entry& E = entry[i];
+      E.due     = std::max( due, current + 1 );
+      E.payload = payload;
+      link( i );
+      count++;
+      return Handle{ i, E.generation };
+    }
+
+    bool cancel( const Handle& h ){
+      if( h.index < 0 or h.index >= int( entry.size() ) ) return false;
+      Entry& E = entry[ h.index ];
+      if( E.generation != h.generation or E.slot == NONE ) return false;
+      unlink( h.index );
+      vacate( h.index );
+      return true;
+    }
+
+    bool pending( const Handle& h ) const { // :scheduled and neither fired nor cancelled
+      return h.index >= 0 and h.index < int( entry.size() ) and entry[ h.index ].generation == h.generation and entry[ h.index ].slot != NONE;
+    }
+
+    template< typename F > unsigned advance( uint64_t now, F&& fire ){
+                                                                                                                              /*
+      Process ticks up to `now` calling `fire( payload )` for every due timer; returns
+      number of fired timers. Ticks without due timers and cascades skipped: current tick
+      jumps to the next one that has something to do (see `horizon`):
+                                                                                                                              */
+      unsigned fired{ 0 };
+      while( current < now ){
+        const uint64_t next{ horizon() }; // :max value if no timers
+        if( next > now ){ current = now; break; }
+        current = next;
+        for( unsigned level = 1; level < LEVELS; level++ ){
+          if( ( current & ( span( level ) - 1 ) ) != 0 ) break;
+          cascade( level );
+        }
+        const int s = int( current & MASK );
+        int i = head[s];
+        head[s] = NONE;
+        while( i != NONE ){
+          const int next{ entry[i].next };
+          entry[i].slot = NONE;
+          if( entry[i].due <= current ){
+            const Payload payload{ std::move( entry[i].payload ) };
+            vacate( i );
+            fire( payload );
+            fired++;
+          } else {
+            link( i ); // :far timer of a single-level wheel
+          }
+          i = next;
+        }
+      }
+      return fired;
+    }
+
+    uint64_t horizon() const {
+                                                                                                                              /*
+      The next tick that has due timers or timers to cascade, i.e. lower bound of the next
+      due tick (max value if no timers). Timer of level `l` linked at tick `t` is due in
+      [ t + SLOTS^l, t + SLOTS^(l+1) ), so its slot is one of the SLOTS slots following the
+      current one and can`t be due before the slot starts. Time passed since linking makes
+      upper level slots start earlier than lower level ones, so the minimum over all levels
+      taken; levels that start later than the bound found skipped:
+                                                                                                                              */
+      uint64_t bound{ std::numeric_limits< uint64_t >::max() };
+      if( count == 0 ) return bound;
+      for( unsigned level = 0; level < LEVELS; level++ ){
+        const uint64_t unit{ span( level ) };
+        const uint64_t base{ current >> ( BITS*level ) };
+        if( ( base + 1 )*unit >= bound ) break; // :this and upper levels start later
+        for( uint64_t k = 1; k <= SLOTS; k++ ){
+          const uint64_t position{ base + k };
+          if( head[ level*SLOTS + ( position & MASK ) ] != NONE ){ bound = std::min( bound, position*unit ); break; }
+        }
+      }
+      return std::max( current + 1, bound );
+    }
+
+  };//TimingWheel
+
+}//namespace CoreAGI
+
+#endif // TIMING_WHEEL_H_INCLUDED
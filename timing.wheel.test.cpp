@@ -0,0 +1,120 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Test of the timing wheel (see `timing.wheel.h`): `horizon` never exceeds the earliest
+ due timer, timers fire at their due tick, cancelled ones never fire. Exit code is the
+ number of failed checks.
+
+ Usage: timing.wheel.test
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#include <cstdint>
+#include <cstdio>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "timing.wheel.h"
+
+namespace CoreAGI {
+
+  unsigned failed{ 0 };
+
+  void check( bool condition, const char* what ){
+    if( condition ) return;
+    printf( " FAILED: %s\n", what );
+    failed++;
+  }
+
+  void horizonAfterTimePassed(){
+                                                                                                                              /*
+    Timer of the upper level linked before time passed is due earlier than the first
+    non-empty slot of the lowest level:
+                                                                                                                              */
+    TimingWheel< int > W;
+    std::vector< uint64_t > fired;
+    auto fire = [&]( int due ){ fired.push_back( uint64_t( due ) ); };
+    W.schedule( 300, 300 );
+    W.schedule( 200, 200 );
+    W.advance ( 200, fire );
+    W.schedule( 450, 450 );
+    W.schedule( 210, 210 );
+    W.advance ( 210, fire );
+    check( W.horizon() <= 300, "horizon bounds timer of upper level" );
+    W.advance( 300, fire );
+    check( fired.size() == 3 and fired.back() == 300, "timer of upper level fired at due tick" );
+    W.advance( 1000000, fire );
+    check( fired.size() == 4 and fired.back() == 450 and W.size() == 0, "all timers fired" );
+  }
+
+  void randomTimers(){
+                                                                                                                              /*
+    Small wheel (cascades and far timers of all levels) against ordered reference:
+                                                                                                                              */
+    using Wheel = TimingWheel< int, 16, 3 >;
+    Wheel                            W( 1000 );
+    std::mt19937_64                  random( 1 );
+    std::multimap< uint64_t, int >   reference;
+    std::vector< Wheel::Handle >     handle;
+    std::map< int, uint64_t >        firedAt;
+    std::vector< bool >              cancelled( 20001, false );
+    for( int i = 1; i <= 20000; i++ ){
+      const uint64_t due{ 1001 + random() % 10000 };
+      handle.push_back( W.schedule( due, i ) );
+      reference.emplace( due, i );
+    }
+    for( int i = 0; i < 20000; i += 7 ) if( W.cancel( handle[i] ) ) cancelled[ i + 1 ] = true;
+    check( not W.cancel( handle[0] ), "second cancel does nothing" );
+    uint64_t t{ 1000 };
+    bool     bounded{ true };
+    auto     pending = reference.begin(); // :earliest timer not fired or cancelled
+    while( W.size() ){
+      while( pending != reference.end() and ( cancelled[ pending->second ] or firedAt.count( pending->second ) ) ) pending++;
+      const uint64_t earliest{ pending == reference.end() ? UINT64_MAX : pending->first };
+      bounded = bounded and W.horizon() > t and W.horizon() <= earliest;
+      const uint64_t to{ t + 1 + random() % 40 };
+      W.advance( to, [&]( int i ){ firedAt[i] = to; } );
+      t = to;
+    }
+    check( bounded, "horizon between current tick and earliest due timer" );
+    unsigned wrong{ 0 };
+    for( auto& [ due, i ]: reference ){
+      if( cancelled[i] ){ if( firedAt.count( i ) ) wrong++; continue; }
+      const uint64_t at{ firedAt[i] };
+      if( at < due or at >= due + 40 ) wrong++;
+    }
+    check( wrong == 0, "timers fired in the advance that passed their due tick, cancelled ones not" );
+  }
+
+  void longGap(){
+                                                                                                                              /*
+    Advance over the span of the top level jumps over empty ticks:
+                                                                                                                              */
+    TimingWheel< int > W;
+    unsigned n{ 0 };
+    W.schedule( 20000000, 1 );
+    W.schedule( 3,        2 );
+    W.advance( 30000000, [&]( int ){ n++; } );
+    check( n == 2 and W.size() == 0 and W.tick() == 30000000, "far timer fired after long gap" );
+  }
+
+}//namespace CoreAGI
+
+
+int main(){
+
+  using namespace CoreAGI;
+
+  horizonAfterTimePassed();
+  randomTimers();
+  longGap();
+  printf( " timing.wheel.test: %u failed\n", failed );
+  return int( failed );
+}
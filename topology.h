@@ -0,0 +1,220 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ CPU topology discovered from `/sys/devices/system/cpu` (physical packages, cores,
+ SMT siblings, CPU sets that share L2 and L3 caches) and placement of the working
+ threads over CPU according to the selected policy:
+
+   COMPACT  fill SMT siblings of a core, then cores sharing the same caches
+   SPREAD   one thread per core over all cache domains first, siblings last
+   CORE     one thread per physical core (SMT siblings not used)
+   LIST     CPU listed explicitly
+
+ Only CPU allowed by the affinity mask of the calling thread are used.
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef TOPOLOGY_H_INCLUDED
+#define TOPOLOGY_H_INCLUDED
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace CoreAGI {
+
+  enum class Placement { NONE, COMPACT, SPREAD, CORE, LIST };
+
+  const char* lex( const Placement& placement ){
+    switch( placement ){
+      case Placement::NONE   : return "none";
+      case Placement::COMPACT: return "compact";
+      case Placement::SPREAD : return "spread";
+      case Placement::CORE   : return "core";
+      case Placement::LIST   : return "list";
+    }
+    return "?";
+  }
+
+
+  struct Topology {
+
+    struct CPU {
+      int id;       // :logical CPU number
+      int package;  // :physical package (socket)
+      int core;     // :core index unique over packages
+      int smt;      // :rank of the CPU among SMT siblings of the core
+      int L2;       // :the lowest CPU number sharing L2 cache with this CPU (-1 if unknown)
+      int L3;       // :the lowest CPU number sharing L3 cache with this CPU (-1 if unknown)
+    };
+
+    std::vector< CPU > cpu;
+
+    static std::vector< int > parseList( const char* text ){
+                                                                                                                              /*
+      Parses CPU list in kernel format, e.g. "0-3,8,10-11":
+                                                                                                                              */
+      std::vector< int > L;
+      const char* s = text;
+      while( *s ){
+        char* e;
+        const long a = strtol( s, &e, 10 );
+        if( e == s ) break;
+        long b = a;
+        s = e;
+        if( *s == '-' ){ b = strtol( s + 1, &e, 10 ); s = e; }
+        for( long i = a; i <= b; i++ ) L.push_back( int( i ) );
+        if( *s == ',' ) s++; else break;
+      }
+      return L;
+    }
+
+    static std::string readLine( const std::string& path ){
+      char line[ 1024 ]{ 0 };
+      if( FILE* f = fopen( path.c_str(), "r" ) ){
+        if( not fgets( line, sizeof( line ), f ) ) line[0] = 0;
+        fclose( f );
+      }
+      return std::string( line );
+    }
+
+    static int readInt( const std::string& path, int fallback = -1 ){
+      const std::string line{ readLine( path ) };
+      return line.empty() ? fallback : atoi( line.c_str() );
+    }
+
+    Topology( const char* ROOT = "/sys/devices/system/cpu" ): cpu{} {
+      const std::string root( ROOT );
+      cpu_set_t allowed;
+      CPU_ZERO( &allowed );
+      const bool masked{ sched_getaffinity( 0, sizeof( allowed ), &allowed ) == 0 };
+      std::vector< int > online = parseList( readLine( root + "/online" ).c_str() );
+      if( online.empty() ) for( int i = 0; i < CPU_SETSIZE; i++ ) if( masked and CPU_ISSET( i, &allowed ) ) online.push_back( i );
+      std::map< std::tuple< int, int >, int > coreIndex; // :( package, core_id ) -> core
+      for( const int id: online ){
+        if( masked and not CPU_ISSET( id, &allowed ) ) continue;
+        const std::string dir{ root + "/cpu" + std::to_string( id ) };
+        CPU c{ id, 0, 0, 0, -1, -1 };
+        c.package = readInt( dir + "/topology/physical_package_id", 0 );
+        const int coreId = readInt( dir + "/topology/core_id", id );
+        const auto key = std::make_tuple( c.package, coreId );
+        if( not coreIndex.contains( key ) ){ const int n = coreIndex.size(); coreIndex[ key ] = n; }
+        c.core = coreIndex[ key ];
+        const auto siblings = parseList( readLine( dir + "/topology/thread_siblings_list" ).c_str() );
+        const auto sibling = std::find( siblings.begin(), siblings.end(), id );
+        c.smt = sibling == siblings.end() ? 0 : int( sibling - siblings.begin() );
+        for( int k = 0; k < 8; k++ ){
+          const std::string cache{ dir + "/cache/index" + std::to_string( k ) };
+          const int level = readInt( cache + "/level" );
+          if( level < 0 ) break;
+          if( readLine( cache + "/type" ).starts_with( "Instruction" ) ) continue;
+          const auto shared = parseList( readLine( cache + "/shared_cpu_list" ).c_str() );
+          const int  lowest = shared.empty() ? id : *std::min_element( shared.begin(), shared.end() );
+          if( level == 2 ) c.L2 = lowest;
+          if( level == 3 ) c.L3 = lowest;
+        }
+        cpu.push_back( c );
+      }
+    }//constructor
+
+    unsigned cores() const {
+      int n{ 0 };
+      for( const auto& c: cpu ) n = std::max( n, c.core + 1 );
+      return n;
+    }
+
+    const CPU* find( int id ) const {
+      for( const auto& c: cpu ) if( c.id == id ) return &c;
+      return nullptr;
+    }
+
+    std::vector< int > place( Placement placement, unsigned n, const std::vector< int >& list = {} ) const {
+                                                                                                                              /*
+      CPU numbers assigned to `n` threads; -1 means `not pinned`.
+      If threads are more than suitable CPU, CPU reused cyclically:
+                                                                                                                              */
+      std::vector< int > order;
+      auto compact = []( const CPU& a, const CPU& b ){
+        return std::tie( a.package, a.L3, a.L2, a.core, a.smt ) < std::tie( b.package, b.L3, b.L2, b.core, b.smt );
+      };
+      switch( placement ){
+
+        case Placement::NONE: break;
+
+        case Placement::LIST: order = list; break;
+
+        case Placement::COMPACT:
+        case Placement::CORE: {
+          std::vector< CPU > C{ cpu };
+          std::sort( C.begin(), C.end(), compact );
+          std::vector< bool > used( cores(), false ); // :for CORE, the first allowed sibling represents the core
+          for( const auto& c: C ){
+            if( placement == Placement::CORE and used[ c.core ] ) continue;
+            used[ c.core ] = true;
+            order.push_back( c.id );
+          }
+          break;
+        }
+
+        case Placement::SPREAD: {
+                                                                                                                              /*
+          Round-robin over cache domains (package, L3); SMT siblings after all cores:
+                                                                                                                              */
+          std::vector< CPU > C{ cpu };
+          std::sort( C.begin(), C.end(), compact );
+          std::map< std::tuple< int, int, int >, std::vector< int > > domain; // :( smt, package, L3 ) -> CPU
+          std::set< int > ranks; // :SMT ranks present (affinity mask can exclude all siblings of some rank)
+          for( const auto& c: C ){
+            domain[ std::make_tuple( c.smt, c.package, c.L3 ) ].push_back( c.id );
+            ranks.insert( c.smt );
+          }
+          for( const int smt: ranks ){
+            std::vector< std::vector< int >* > D;
+            for( auto& [ key, L ]: domain ) if( std::get<0>( key ) == smt ) D.push_back( &L );
+            for( size_t i = 0;; i++ ){
+              bool any{ false };
+              for( auto* L: D ) if( i < L->size() ){ order.push_back( (*L)[i] ); any = true; }
+              if( not any ) break;
+            }
+          }
+          break;
+        }
+
+      }//switch placement
+      std::vector< int > result( n, -1 );
+      if( not order.empty() ) for( unsigned i = 0; i < n; i++ ) result[i] = order[ i % order.size() ];
+      return result;
+    }
+
+  };//Topology
+
+
+  bool pin( std::thread::native_handle_type thread, int id ){
+                                                                                                                              /*
+    Bind thread to the single CPU; returns `false` if failed:
+                                                                                                                              */
+    if( id < 0 ) return false;
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( id, &set );
+    return pthread_setaffinity_np( thread, sizeof( set ), &set ) == 0;
+  }
+
+}//namespace CoreAGI
+
+#endif // TOPOLOGY_H_INCLUDED
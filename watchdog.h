@@ -0,0 +1,188 @@
+                                                                                                                              /*
+ Copyright Mykola Rabchevskiy 2026.
+ Distributed under the Boost Software License, Version 1.0.
+ (See http://www.boost.org/LICENSE_1_0.txt)
+ ______________________________________________________________________________
+
+ Step watchdog: own thread samples `Occupancy` slots of Staff members every PERIOD and
+ flags the step that runs longer than the budget of its process (`Schedule::budget`) or,
+ if the process has no budget, than the default one. Such step occupies the member and
+ delays everything queued behind it: endless loop, blocking call, writer spinning in the
+ access return loop of the Fluid (RETURN_ACCESS_TIMEOUT) and so on.
+
+ Offending step reported to the log once (process, its step index, member) when flagged
+ and once more when it finishes; numbers of overruns and the longest observed steps per
+ process are kept for `offenders` and `info`. Members only store into own slot at the
+ step boundaries, so the watchdog costs them nothing else; duration of the overrun is
+ known with PERIOD resolution.
+
+   StepWatchdog watchdog( staff );
+   watchdog.start();
+   ...
+   watchdog.stop();
+   watchdog.info( log );
+
+ 2026.10.18  Initial version
+
+________________________________________________________________________________________________________________________________
+                                                                                                                              */
+#ifndef WATCHDOG_H_INCLUDED
+#define WATCHDOG_H_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "config.h"
+#include "logical.process.h"
+#include "logger.h"
+#include "staff.h"
+#include "timer.h"
+
+namespace CoreAGI {
+
+  class StepWatchdog {
+  public:
+
+    struct Offender {
+      std::string name;
+      uint64_t    overruns; // :steps flagged
+      double      longest;  // :longest observed step, nanosec
+      uint64_t    step;     // :index of the longest step
+    };
+
+  private:
+
+    struct Watch {
+      uint64_t              serial;  // :serial of the flagged step, 0 if none
+      const LogicalProcess* process;
+      std::string           name;
+      uint64_t              step;
+      double                elapsed; // :observed so far, nanosec
+    };
+
+    StaffCore&                                            staff;
+    const double                                          BUDGET; // :default step budget, nanosec
+    const unsigned                                        PERIOD; // :millisec
+    std::vector< Watch >                                  watch;  // :per member, touched by watchdog thread only
+    mutable std::mutex                                    keeping; // :protects `offender`
+    std::unordered_map< const LogicalProcess*, Offender > offender;
+    std::atomic< uint64_t >                               total;
+    std::thread                                           thread;
+    std::atomic< bool >                                   terminate;
+
+    void sample( const Log& log ){
+      const double now{ LogicalProcess::now().nsec() };
+      staff.surveyOccupancy( [&]( unsigned i, const std::string& member, const LogicalProcess::Occupancy& O ){
+        if( i >= watch.size() ) watch.resize( i + 1, Watch{ 0, nullptr, {}, 0, 0 } );
+        Watch& W = watch[i];
+                                                                                                                              /*
+        Consistent reading of the slot (see `LogicalProcess::Occupancy`):
+                                                                                                                              */
+        const uint64_t s{ O.serial.load( std::memory_order_acquire ) };
+        const LogicalProcess* p     { O.process.load( std::memory_order_relaxed ) };
+        const char*           name  { O.name   .load( std::memory_order_relaxed ) };
+        const double          budget{ O.budget .load( std::memory_order_relaxed ) };
+        const double          start { O.start  .load( std::memory_order_relaxed ) };
+        const uint64_t        step  { O.step   .load( std::memory_order_relaxed ) };
+        std::atomic_thread_fence( std::memory_order_acquire );
+        const bool running{ ( s & 1 ) and O.serial.load( std::memory_order_relaxed ) == s };
+        if( W.serial and W.serial != s ){
+          log.brief( kit( "member `%s`: process `%s` step %llu finished after %.3f ms at least",
+                          member.c_str(), W.name.c_str(), (unsigned long long) W.step, 1.0e-6*W.elapsed ) );
+          W.serial = 0;
+        }
+        if( not running ) return;
+        const double elapsed{ now - start };
+        const double limit  { budget > 0 ? budget : BUDGET };
+        if( elapsed <= limit ) return;
+        std::lock_guard< std::mutex > lock( keeping );
+        auto [ j, inserted ] = offender.try_emplace( p, Offender{ name ? name : "?", 0, 0, 0 } );
+        Offender& F = j->second;
+        if( W.serial != s ){
+          W = Watch{ s, p, F.name, step, elapsed };
+          F.overruns++;
+          total.fetch_add( 1, std::memory_order_relaxed );
+          log.brief( kit( "member `%s`: process `%s` step %llu runs %.3f ms, budget %.3f ms",
+                          member.c_str(), F.name.c_str(), (unsigned long long) step, 1.0e-6*elapsed, 1.0e-6*limit ) );
+        }
+        W.elapsed = elapsed;
+        if( elapsed > F.longest ){ F.longest = elapsed; F.step = step; }
+      });
+    }
+
+    void run(){
+      auto log = logger.log( "watchdog" );
+      while( not terminate.load() ){
+        pause{ PERIOD }[ MILLISEC ];
+        sample( log );
+      }
+    }
+
+  public:
+
+    StepWatchdog( StaffCore& observed,
+                  const Duration& budget = Duration::Value{ double( Config::staff::WATCHDOG_BUDGET ) }[ MICROSEC ],
+                  unsigned period = Config::staff::WATCHDOG_PERIOD ):
+      staff    { observed                   },
+      BUDGET   { budget.endo()              },
+      PERIOD   { std::max( 1u, period )     },
+      watch    {                            },
+      keeping  {                            },
+      offender {                            },
+      total    { 0                          },
+      thread   {                            },
+      terminate{ false                      }
+    {}
+
+    StepWatchdog( const StepWatchdog& )              = delete;
+    StepWatchdog& operator = ( const StepWatchdog& ) = delete;
+
+    void start(){
+      if( thread.joinable() ) return;
+      terminate.store( false );
+      thread = std::thread( &StepWatchdog::run, this );
+    }
+
+    void stop(){
+      terminate.store( true );
+      if( thread.joinable() ) thread.join();
+    }
+
+    uint64_t overruns() const { return total.load(); } // :steps flagged so far
+
+    std::vector< Offender > offenders() const {
+                                                                                                                              /*
+      Processes that had flagged steps, most frequent offender first:
+                                                                                                                              */
+      std::vector< Offender > list;
+      {
+        std::lock_guard< std::mutex > lock( keeping );
+        for( const auto& [ p, F ]: offender ) list.push_back( F );
+      }
+      std::sort( list.begin(), list.end(), []( const Offender& a, const Offender& b ){
+        return a.overruns != b.overruns ? a.overruns > b.overruns : a.longest > b.longest;
+      });
+      return list;
+    }
+
+    void info( const Log& log ) const {
+      const auto list{ offenders() };
+      log.vital( kit( "Step watchdog: %llu steps over budget, %u processes", (unsigned long long) overruns(), unsigned( list.size() ) ) );
+      for( const auto& F: list ){
+        log.vital( kit( "  %-20s %8llu overruns, longest step %llu: %.3f ms at least",
+                        F.name.c_str(), (unsigned long long) F.overruns, (unsigned long long) F.step, 1.0e-6*F.longest ) );
+      }
+    }
+
+   ~StepWatchdog(){ stop(); }
+
+  };//StepWatchdog
+
+}//namespace CoreAGI
+
+#endif // WATCHDOG_H_INCLUDED